@@ -0,0 +1,401 @@
+import com.berkeley.abc.Abc;
+
+import java.io.BufferedReader;
+import java.io.FileReader;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+/*
+ * Regression benchmark for libabc2java.
+ *
+ * Generates a deterministic corpus (adder and multiplier miters, random
+ * AIGs, unrolled counters) and runs every instance through three drivers:
+ * Fraig_ManCreate + Fraig_NodesAreEqual, Ivy_FraigPerform on the miter,
+ * and building the miter as an Abc network followed by Abc_NtkCheck.
+ * For each run it records the median wall time, the peak RSS (VmHWM, reset
+ * through /proc/self/clear_refs before each run) and, for FRAIG, the SAT
+ * calls and conflicts.
+ *
+ *   java -Djava.library.path=... AbcBench [--reps N] [--save FILE]
+ *        [--baseline FILE] [--threshold PCT] [--filter SUBSTRING]
+ *
+ * With --baseline, time and RSS are compared against the stored results and
+ * the exit code is 1 if any instance is slower or larger by more than the
+ * threshold (default 10%). Results are tab-separated, one instance per line.
+ */
+public class AbcBench {
+
+    /*
+     * Builds AIG nodes in one of the three managers. All of them tag
+     * complemented edges in bit 0, so negation is shared.
+     */
+    static abstract class Builder {
+        abstract long const1();
+        abstract long pi();
+        abstract long and( long a, long b );
+
+        long not( long a )           { return a ^ 1L; }
+        long or( long a, long b )    { return not(and(not(a), not(b))); }
+        long xor( long a, long b )   { return or(and(a, not(b)), and(not(a), b)); }
+        long mux( long s, long a, long b ) { return or(and(s, a), and(not(s), b)); }
+
+        long[] pis( int n ) {
+            long[] v = new long[n];
+            for (int i = 0; i < n; i++) {
+                v[i] = pi();
+            }
+            return v;
+        }
+    }
+
+    static final class FraigBuilder extends Builder {
+        final long man;
+        FraigBuilder( long man ) { this.man = man; }
+        long const1()             { return Abc.Fraig_ManReadConst1(man); }
+        long pi()                 { return Abc.Fraig_ManReadIthVar(man, Abc.Fraig_ManReadInputNum(man)); }
+        long and( long a, long b ) { return Abc.Fraig_NodeAnd(man, a, b); }
+    }
+
+    static final class IvyBuilder extends Builder {
+        final long man;
+        IvyBuilder( long man ) { this.man = man; }
+        long const1()             { return Abc.Ivy_ManConst1(man); }
+        long pi()                 { return Abc.Ivy_ObjCreatePi(man); }
+        long and( long a, long b ) { return Abc.Ivy_And(man, a, b); }
+    }
+
+    static final class AbcBuilder extends Builder {
+        final long ntk;
+        AbcBuilder( long ntk ) { this.ntk = ntk; }
+        long const1()             { return Abc.Abc_AigConst1(ntk); }
+        long pi()                 { return Abc.Abc_NtkCreatePi(ntk); }
+        long and( long a, long b ) { return Abc.Abc_AigAnd(ntk, a, b); }
+    }
+
+    /*
+     * A corpus instance: builds pairs of functions that should be compared
+     * (equivalent or not) and returns them as { lhs[], rhs[] }.
+     */
+    interface Instance {
+        long[][] build( Builder b );
+    }
+
+    // 64-bit LCG (Knuth's MMIX constants), fixed seeds keep the corpus stable
+    static final class Lcg {
+        long state;
+        Lcg( long seed ) { state = seed; }
+        int next( int bound ) {
+            state = state * 6364136223846793005L + 1442695040888963407L;
+            return (int) ((state >>> 33) % bound);
+        }
+    }
+
+    static long[] rippleAdd( Builder b, long[] x, long[] y ) {
+        long[] s = new long[x.length];
+        long c = b.not(b.const1());
+        for (int i = 0; i < x.length; i++) {
+            s[i] = b.xor(b.xor(x[i], y[i]), c);
+            c = b.or(b.and(x[i], y[i]), b.and(c, b.xor(x[i], y[i])));
+        }
+        return s;
+    }
+
+    static long[] multiply( Builder b, long[] x, long[] y ) {
+        long zero = b.not(b.const1());
+        long[] acc = new long[x.length];
+        Arrays.fill(acc, zero);
+        for (int i = 0; i < y.length; i++) {
+            long[] row = new long[x.length];
+            for (int k = 0; k < x.length; k++) {
+                row[k] = k < i ? zero : b.and(x[k - i], y[i]);
+            }
+            acc = rippleAdd(b, acc, row);
+        }
+        return acc;
+    }
+
+    // (a + b) + c against a + (b + c)
+    static Instance adderAssoc( final int n ) {
+        return b -> {
+            long[] x = b.pis(n), y = b.pis(n), z = b.pis(n);
+            return new long[][] { rippleAdd(b, rippleAdd(b, x, y), z), rippleAdd(b, x, rippleAdd(b, y, z)) };
+        };
+    }
+
+    // a * b against b * a
+    static Instance multComm( final int n ) {
+        return b -> {
+            long[] x = b.pis(n), y = b.pis(n);
+            return new long[][] { multiply(b, x, y), multiply(b, y, x) };
+        };
+    }
+
+    // random AIG, compared at randomly chosen node pairs
+    static Instance random( final long seed, final int nPis, final int nAnds, final int nPairs ) {
+        return b -> {
+            Lcg r = new Lcg(seed);
+            long[] nodes = new long[nPis + nAnds];
+            System.arraycopy(b.pis(nPis), 0, nodes, 0, nPis);
+            for (int i = nPis; i < nodes.length; i++) {
+                long f0 = nodes[r.next(i)] ^ r.next(2);
+                long f1 = nodes[r.next(i)] ^ r.next(2);
+                nodes[i] = b.and(f0, f1);
+            }
+            long[][] pairs = new long[2][nPairs];
+            for (int i = 0; i < nPairs; i++) {
+                pairs[0][i] = nodes[nPis + r.next(nAnds)];
+                pairs[1][i] = nodes[nPis + r.next(nAnds)] ^ r.next(2);
+            }
+            return pairs;
+        };
+    }
+
+    // n-bit counter with enable, unrolled k frames, against a second
+    // next-state implementation (increment by adding the enable bit)
+    static Instance counter( final int n, final int k ) {
+        return b -> {
+            long zero = b.not(b.const1());
+            long[] s1 = b.pis(n);
+            long[] s2 = s1.clone();
+            for (int f = 0; f < k; f++) {
+                long en = b.pi();
+                long carry = en;
+                long[] n1 = new long[n];
+                for (int i = 0; i < n; i++) {
+                    n1[i] = b.xor(s1[i], carry);
+                    carry = b.and(s1[i], carry);
+                }
+                long[] inc = new long[n];
+                Arrays.fill(inc, zero);
+                inc[0] = b.const1();
+                long[] n2 = rippleAdd(b, s2, inc);
+                for (int i = 0; i < n; i++) {
+                    n2[i] = b.mux(en, n2[i], s2[i]);
+                }
+                s1 = n1;
+                s2 = n2;
+            }
+            return new long[][] { s1, s2 };
+        };
+    }
+
+    static Map<String, Instance> corpus() {
+        Map<String, Instance> c = new LinkedHashMap<>();
+        c.put("adder-assoc-64", adderAssoc(64));
+        c.put("adder-assoc-256", adderAssoc(256));
+        c.put("mult-comm-8", multComm(8));
+        c.put("mult-comm-10", multComm(10));
+        c.put("random-64x20k", random(0x5eedL, 64, 20000, 2000));
+        c.put("random-256x100k", random(0xfeedL, 256, 100000, 5000));
+        c.put("counter-16x32", counter(16, 32));
+        c.put("counter-32x64", counter(32, 64));
+        return c;
+    }
+
+    /*
+     * Result of one run; -1 marks a counter the driver does not report.
+     */
+    static final class Result {
+        double ms;
+        long rssKb = -1;
+        long satCalls = -1;
+        long conflicts = -1;
+        int failed;           // pairs that were not proved equal
+    }
+
+    interface Driver {
+        void run( Instance inst, Result res );
+    }
+
+    static final int BT_LIMIT = 100000;
+    static final int TIME_LIMIT = 60;
+
+    static void fraigDriver( Instance inst, Result res ) {
+        long man = Abc.Fraig_ManCreate(Abc.Fraig_ParamsGetDefault());
+        long[][] p = inst.build(new FraigBuilder(man));
+        for (int i = 0; i < p[0].length; i++) {
+            if (!Abc.Fraig_NodesAreEqual(man, p[0][i], p[1][i], BT_LIMIT, TIME_LIMIT)) {
+                res.failed++;
+            }
+        }
+        res.satCalls = Abc.Fraig_ManReadSimStats(man)[3];
+        res.conflicts = Abc.Fraig_ManReadSatConflicts(man);
+        Abc.Fraig_ManFree(man);
+    }
+
+    static void ivyDriver( Instance inst, Result res ) {
+        long man = Abc.Ivy_ManStart();
+        IvyBuilder b = new IvyBuilder(man);
+        long[][] p = inst.build(b);
+        for (int i = 0; i < p[0].length; i++) {
+            Abc.Ivy_ObjCreatePo(man, b.xor(p[0][i], p[1][i]));
+        }
+        long fraiged = Abc.Ivy_FraigPerform(man, Abc.Ivy_FraigParamsDefault());
+        if (fraiged != 0) {
+            Abc.Ivy_ManStop(fraiged);
+        }
+        Abc.Ivy_ManStop(man);
+    }
+
+    static void abcDriver( Instance inst, Result res ) {
+        long ntk = Abc.Abc_NtkAlloc();
+        AbcBuilder b = new AbcBuilder(ntk);
+        long[][] p = inst.build(b);
+        for (int i = 0; i < p[0].length; i++) {
+            Abc.Abc_ObjAddFanin(Abc.Abc_NtkCreatePo(ntk), b.xor(p[0][i], p[1][i]));
+        }
+        if (!Abc.Abc_NtkCheck(ntk)) {
+            res.failed++;
+        }
+        Abc.Abc_NtkDelete(ntk);
+    }
+
+    // peak RSS is per process, so it is reset before each run (linux >= 4.0)
+    static void resetPeakRss() {
+        try (FileWriter w = new FileWriter("/proc/self/clear_refs")) {
+            w.write("5");
+        } catch (IOException e) {
+            // not linux, or not permitted: the peak then covers earlier runs
+        }
+    }
+
+    static long readPeakRssKb() {
+        try {
+            for (String line : Files.readAllLines(Paths.get("/proc/self/status"))) {
+                if (line.startsWith("VmHWM:")) {
+                    return Long.parseLong(line.replaceAll("[^0-9]", ""));
+                }
+            }
+        } catch (IOException | NumberFormatException e) {
+            // fall through
+        }
+        return -1;
+    }
+
+    static Result measure( Driver d, Instance inst, int reps ) {
+        double[] times = new double[reps];
+        Result res = null;
+        long rss = -1;
+        for (int r = 0; r < reps; r++) {
+            res = new Result();
+            System.gc();
+            resetPeakRss();
+            long t0 = System.nanoTime();
+            d.run(inst, res);
+            times[r] = (System.nanoTime() - t0) / 1e6;
+            rss = Math.max(rss, readPeakRssKb());
+        }
+        Arrays.sort(times);
+        res.ms = times[reps / 2];
+        res.rssKb = rss;
+        return res;
+    }
+
+    static final String HEADER = "name\tms\trss_kb\tsat_calls\tconflicts\tfailed";
+
+    static String format( String name, Result r ) {
+        return String.format("%s\t%.3f\t%d\t%d\t%d\t%d", name, r.ms, r.rssKb, r.satCalls, r.conflicts, r.failed);
+    }
+
+    static Map<String, String[]> readResults( String file ) throws IOException {
+        Map<String, String[]> m = new LinkedHashMap<>();
+        try (BufferedReader in = new BufferedReader(new FileReader(file))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.isEmpty() || line.startsWith("name\t")) {
+                    continue;
+                }
+                String[] f = line.split("\t");
+                m.put(f[0], f);
+            }
+        }
+        return m;
+    }
+
+    // true if cur exceeds base by more than threshold percent
+    static boolean regressed( double cur, double base, double threshold ) {
+        return base > 0 && cur > base * (1 + threshold / 100);
+    }
+
+    public static void main( String[] args ) throws IOException {
+        int reps = 3;
+        double threshold = 10;
+        String save = null, baseline = null, filter = "";
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "--reps":      reps = Integer.parseInt(args[++i]); break;
+                case "--threshold": threshold = Double.parseDouble(args[++i]); break;
+                case "--save":      save = args[++i]; break;
+                case "--baseline":  baseline = args[++i]; break;
+                case "--filter":    filter = args[++i]; break;
+                default:
+                    System.err.println("usage: AbcBench [--reps N] [--save FILE] [--baseline FILE] [--threshold PCT] [--filter S]");
+                    System.exit(2);
+            }
+        }
+
+        Map<String, Driver> drivers = new LinkedHashMap<>();
+        drivers.put("fraig", AbcBench::fraigDriver);
+        drivers.put("ivy", AbcBench::ivyDriver);
+        drivers.put("abc", AbcBench::abcDriver);
+
+        Abc.Abc_Start();
+        List<String> lines = new ArrayList<>();
+        lines.add(HEADER);
+        System.out.println(HEADER);
+        for (Map.Entry<String, Instance> inst : corpus().entrySet()) {
+            for (Map.Entry<String, Driver> d : drivers.entrySet()) {
+                String name = d.getKey() + "/" + inst.getKey();
+                if (!name.contains(filter)) {
+                    continue;
+                }
+                String line = format(name, measure(d.getValue(), inst.getValue(), reps));
+                lines.add(line);
+                System.out.println(line);
+            }
+        }
+        Abc.Abc_Stop();
+
+        if (save != null) {
+            try (PrintWriter out = new PrintWriter(new FileWriter(save))) {
+                for (String line : lines) {
+                    out.println(line);
+                }
+            }
+        }
+        if (baseline == null) {
+            return;
+        }
+
+        Map<String, String[]> base = readResults(baseline);
+        int nRegressions = 0;
+        for (String line : lines.subList(1, lines.size())) {
+            String[] cur = line.split("\t");
+            String[] old = base.get(cur[0]);
+            if (old == null) {
+                continue;
+            }
+            double ms = Double.parseDouble(cur[1]), oldMs = Double.parseDouble(old[1]);
+            long rss = Long.parseLong(cur[2]), oldRss = Long.parseLong(old[2]);
+            boolean slow = regressed(ms, oldMs, threshold);
+            boolean big = regressed(rss, oldRss, threshold);
+            if (slow || big) {
+                nRegressions++;
+                System.err.printf("REGRESSION %s: %.3f ms (was %.3f), %d kB (was %d)%n", cur[0], ms, oldMs, rss, oldRss);
+            }
+            if (!cur[4].equals(old[4])) {
+                System.err.printf("note %s: conflicts %s (was %s)%n", cur[0], cur[4], old[4]);
+            }
+        }
+        System.err.println(nRegressions == 0 ? "no regressions" : nRegressions + " regression(s)");
+        System.exit(nRegressions == 0 ? 0 : 1);
+    }
+}
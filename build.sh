@@ -46,7 +46,16 @@ fi
 
 cd ./src/main/java/com/berkeley/abc/
 
-if CLASSPATH=${ABC_CLASSPATH} make && make install ; then
+# ABC_RELEASE=1 builds the optimized (-O3, LTO) variant
+if [[ "$ABC_RELEASE" == "1" ]]; then
+    TARGET=release
+    INSTALL=install-release
+else
+    TARGET=all
+    INSTALL=install
+fi
+
+if CLASSPATH=${ABC_CLASSPATH} make ${TARGET} && make ${INSTALL} ; then
     echo "Installed the Abc2Java wrapper in ${ABC_JNI}"
 else
     echo "Could not install the Abc2Java wrapper"
@@ -0,0 +1,29 @@
+import com.berkeley.abc.Abc;
+
+import java.util.Arrays;
+
+public class InitOneCex {
+
+    // a latch that starts at 1 and holds its value fails a PO that watches it
+    // in frame 0; the counter-example must report the latch as 1
+    public static void main(String[] arg) {
+		Abc.Abc_Start();
+		long pNtk = Abc.Abc_NtkAlloc();
+		long pLatch = Abc.Abc_NtkCreateLatch(pNtk);
+		Abc.Abc_LatchSetInit(pLatch, 1);
+		Abc.Abc_ObjAddFanin(Abc.Abc_LatchInput(pLatch), Abc.Abc_LatchOutput(pLatch));
+		Abc.Abc_ObjAddFanin(Abc.Abc_NtkCreatePo(pNtk), Abc.Abc_LatchOutput(pLatch));
+
+		int status = Abc.Abc_NtkBmc3(pNtk, Abc.Bmc_ParamsGetDefault());
+		int[] init = Abc.Abc_NtkCexInit(pNtk);
+		System.out.println("Bmc3 " + status + ", frame " + Abc.Abc_NtkCexFrame(pNtk) + ", init " + Arrays.toString(init));
+		boolean ok = status == 0 && init != null && init.length == 1 && init[0] == 1;
+
+		Abc.Abc_NtkDelete(pNtk);
+		Abc.Abc_Stop();
+		if (!ok) {
+			System.out.println("init-1 latch reported wrongly");
+			System.exit(1);
+		}
+    }
+}
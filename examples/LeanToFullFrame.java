@@ -0,0 +1,14 @@
+import com.berkeley.abc.Abc;
+
+public class LeanToFullFrame {
+
+    // Abc_Start after Abc_StartLean must leave a frame Abc_Stop can end
+    public static void main(String[] arg) {
+		Abc.Abc_StartLean();
+		Abc.Abc_Start();
+		long pNtk = Abc.Abc_NtkAlloc();
+		Abc.Abc_NtkDelete(pNtk);
+		Abc.Abc_Stop();
+		System.out.println("Lean frame replaced and stopped");
+    }
+}
@@ -31,10 +31,22 @@ public final class Abc {
     public static final String versionString = "1.0.0";
     public static final String buildDate = "March 7 2022";
 
+    /*
+     * All three managers (Abc, Fraig, Ivy) tag complemented edges in the
+     * low bit of the object pointer, like ABC's own Abc_ObjNot/Fraig_Not/Ivy_Not
+     * macros. The pure pointer-bit accessors below are therefore computed
+     * on the Java side and never cross into native code.
+     */
+
 
     // Abc Network
     public static native void Abc_Start();
+    // no command tables; enough for Fraig, Ivy and Cnf. A later Abc_Start
+    // replaces the lean frame by a full one.
+    public static native void Abc_StartLean();
     public static native void Abc_Stop();
+    // built with 'make lean': only Fraig, Ivy and Cnf natives are present
+    public static native boolean Abc_IsLean();
 
     public static native long Abc_NtkAlloc();
     public static native void Abc_NtkDelete( long pAig );
@@ -46,27 +58,41 @@ public final class Abc {
     public static native long Abc_NtkCreatePi( long pAig );
     public static native long Abc_NtkCreatePo( long pAig );
 
+    // Latches: connect the next-state function to Abc_LatchInput and use
+    // Abc_LatchOutput as the current-state input; init is 0, 1 or 2 (don't-care)
+    public static native long Abc_NtkCreateLatch( long pAig );
+    public static native long Abc_LatchInput( long pLatch );
+    public static native long Abc_LatchOutput( long pLatch );
+    public static native void Abc_LatchSetInit( long pLatch, int init );
+
     public static native int Abc_NtkPiNum( long pAig );
     public static native int Abc_NtkPoNum( long pAig );
+    public static native int Abc_NtkLatchNum( long pAig );
 
 
     // Aig
     public static native long Abc_AigConst1( long pAig );
     public static native long Abc_AigAnd( long pAig, long pObjA, long pObjB );
     public static native long Abc_AigOr( long pAig, long pObjA, long pObjB );
-    public static native long Abc_ObjNot( long pObj );
+    public static long Abc_ObjNot( long pObj ) { return pObj ^ 1L; }
     public static native void Abc_ObjAddFanin( long pObjO, long pObjI );
 
     public static native void Abc_AigPrintNode( long pObj );
-    public static native long Abc_ObjRegular( long pObj );
+    public static long Abc_ObjRegular( long pObj ) { return pObj & ~1L; }
     public static native long Abc_ObjId( long pObj );
     public static native void Abc_ObjAssignName( long pObj, String name );
     public static native String Abc_ObjName( long pObj );
+    // Bulk names in one UTF-8 buffer: name i is buf[offsets[i]..offsets[i+1]),
+    // so offsets has one entry more than there are names. Lookups give 0
+    // for missing names.
+    public static native void Abc_NtkAssignNames( long pAig, long[] objs, byte[] buf, int[] offsets );
+    public static native byte[] Abc_NtkReadNames( long pAig, long[] objs, int[] offsets );
+    public static native long[] Abc_NtkFindObjs( long pAig, byte[] buf, int[] offsets, boolean fCos );
 
     public static native void Abc_AigCleanup( long pAig );
 
     public static native boolean Abc_ObjIsCi( long pObj );
-    public static native boolean Abc_ObjIsComplement( long pObj );
+    public static boolean Abc_ObjIsComplement( long pObj ) { return (pObj & 1L) != 0; }
     public static native boolean Abc_AigNodeIsConst( long pObj );
 
     public static native long Abc_ObjFanin0( long pObj );
@@ -77,6 +103,321 @@ public final class Abc {
     public static native long Abc_ObjChild0( long pObj );
     public static native long Abc_ObjChild1( long pObj );
 
+    // Literal handles: 2*Id + complement, dense per manager, so Java side
+    // metadata can live in plain int[] tables sized by the id bound.
+    public static int Abc_Var2Lit( int id, boolean fCompl ) { return id + id + (fCompl ? 1 : 0); }
+    public static int Abc_Lit2Var( int lit ) { return lit >> 1; }
+    public static int Abc_LitNot( int lit ) { return lit ^ 1; }
+    public static int Abc_LitRegular( int lit ) { return lit & ~1; }
+    public static boolean Abc_LitIsCompl( int lit ) { return (lit & 1) != 0; }
+
+    public static native int Abc_NtkObjNumMax( long pAig );
+    public static native int Abc_ObjToLit( long pObj );
+    public static native long Abc_NtkObjFromLit( long pAig, int lit );
+    public static native int Abc_NtkCreatePiLit( long pAig );
+    public static native int Abc_AigConst1Lit( long pAig );
+    public static native int Abc_AigAndLit( long pAig, int litA, int litB );
+    public static native int Abc_AigOrLit( long pAig, int litA, int litB );
+    public static native int Abc_ObjChild0Lit( long pAig, int lit );
+    public static native int Abc_ObjChild1Lit( long pAig, int lit );
+    // The bulk conversions need arrays of equal length; literals of ids
+    // out of range or of deleted objects throw.
+    public static native void Abc_NtkLitsToObjs( long pAig, int[] lits, long[] objs );
+    public static native void Abc_ObjsToLits( long[] objs, int[] lits );
+
+    // Cones and partitions
+    public static native long Abc_NtkCreateConeOutputs( long pAig, int[] pos, boolean fUseAllCis );
+    public static native long[] Abc_NtkPartitionOutputs( long pAig, int nParts, int[] poToPart, boolean fUseAllCis );
+
+    // Design diff: indices of the POs (roots) of the new design whose cones
+    // have no structurally identical counterpart in the old one.
+    public static native int[] Abc_NtkDiffOutputs( long pOld, long pNew );
+    public static native int[] Ivy_ManDiffRoots( long fOld, long fNew, long[] oldRoots, long[] newRoots );
+    // Adds the PO functions of a network to a long-lived Fraig manager; each
+    // new revision reuses the equivalences proven for the previous ones.
+    public static native long[] Fraig_ManAddNtk( long fAig, long pAig );
+
+    // Cnf: plain Tseitin (fMapped=false) or ABC's mapping-based encoding,
+    // which uses a global ABC manager and so runs one call at a time.
+    // nodeLits is indexed by object id and receives signed DIMACS literals
+    // (0 when the node has no variable).
+    public static native long Abc_NtkDeriveCnf( long pAig, boolean fMapped, int[] nodeLits );
+    public static native long Ivy_ManDeriveCnf( long fAig, long[] roots, boolean fMapped, int[] nodeLits, int[] rootLits );
+    public static native int Cnf_DataNumVars( long pCnf );
+    public static native int Cnf_DataNumClauses( long pCnf );
+    public static native long Cnf_DataBufferSize( long pCnf );
+    // buf must be direct; read it back with ByteOrder.nativeOrder()
+    public static native long Cnf_DataWriteClauses( long pCnf, java.nio.ByteBuffer buf );
+    public static native void Cnf_DataFree( long pCnf );
+
+    // Sequential engines: prove all POs of a network with latches are 0.
+    // Return 1 if proved, 0 if a counter-example was found, -1 if undecided.
+    // Latches with a don't-care init are rejected (here, in the portfolio
+    // and in Gia_ManFromNtk).
+    public static native long Pdr_ParamsGetDefault();
+    public static native void Pdr_ParamsSet_nTimeOut( long pParams, int n );
+    public static native void Pdr_ParamsSet_nFrameMax( long pParams, int n );
+    public static native void Pdr_ParamsSet_nConfLimit( long pParams, int n );
+    public static native void Pdr_ParamsSet_fVerbose( long pParams, int n );
+    // the inductive invariant is written here as a PLA when proved (null: off)
+    public static native void Pdr_ParamsSetInvFile( long pParams, String fileName );
+    public static native long Bmc_ParamsGetDefault();
+    public static native void Bmc_ParamsSet_nTimeOut( long pParams, int n );
+    public static native void Bmc_ParamsSet_nFramesMax( long pParams, int n );
+    public static native void Bmc_ParamsSet_nConfLimit( long pParams, int n );
+    public static native void Bmc_ParamsSet_fVerbose( long pParams, int n );
+    public static native int Abc_NtkPdr( long pAig, long pParams );
+    // invariant of the last Abc_NtkPdr proof, null if it proved nothing:
+    // { nCubes, then per cube nLits, lits } with lit 2*latch + (value == 0);
+    // the invariant is the conjunction of the negated cubes
+    public static native int[] Abc_NtkPdrInvariant( long pAig );
+    public static native int Abc_NtkBmc3( long pAig, long pParams );
+    // k-induction: BMC checks the base case to nFramesMax frames first (a
+    // failure there is the counter-example); a failed inductive step is -1
+    public static native int Abc_NtkInduction( long pAig, int nTimeOut, int nFramesMax, int nConfMax, boolean fUnique );
+    // Counter-example of the last run; init holds the latch values in
+    // latch order (1 for init-1 latches), inputs are the PI values of
+    // frames 0..Abc_NtkCexFrame, flattened frame by frame
+    public static native int Abc_NtkCexFrame( long pAig );
+    public static native int Abc_NtkCexPo( long pAig );
+    public static native int[] Abc_NtkCexInit( long pAig );
+    public static native int[] Abc_NtkCexInputs( long pAig );
+
+    // Portfolio: races the added engine configurations on copies of a miter
+    // (or of a network with latches) and returns the first conclusive answer,
+    // 1 proved, 0 failed, -1 undecided; Abc_PortfolioReadWinner gives the
+    // index of the engine that answered. nTimeOutMs 0 means no limit.
+    // PDR and BMC are stopped when Solve returns, and the SAT engine (Gia
+    // &cec) at nTimeOutMs rounded up to seconds; FRAIG and Ivy FRAIG cannot
+    // be cancelled and run to their conflict limits. Their threads are
+    // joined by the next Solve, by Abc_PortfolioStop and by Abc_Stop, which
+    // can therefore block until they finish.
+    public static native long Abc_PortfolioStart();
+    public static native void Abc_PortfolioStop( long pPort );
+    public static native int Abc_PortfolioAddFraig( long pPort, long fParams );
+    public static native int Abc_PortfolioAddIvyFraig( long pPort, int nConfLimit, boolean fDoSparse );
+    public static native int Abc_PortfolioAddSat( long pPort, int nConfLimit );
+    public static native int Abc_PortfolioAddPdr( long pPort, long pParams );
+    public static native int Abc_PortfolioAddBmc3( long pPort, long pParams );
+    public static native int Abc_PortfolioSolve( long pPort, long pAig, int nTimeOutMs );
+    public static native int Abc_PortfolioReadWinner( long pPort );
+    // Engine i is pinned to cpus[i % cpus.length] (linux; empty: no pinning)
+    // and allocates its copy of the network on that cpu's NUMA node.
+    // Placement is { cpu, node, status } per engine of the last run, cpu
+    // and node -1 if unknown; status is 1 if pinned, 0 if not asked to be,
+    // -errno if pinning failed (all -1 if the engine had not started).
+    public static native void Abc_PortfolioSetCpus( long pPort, int[] cpus );
+    public static native int[] Abc_PortfolioReadPlacement( long pPort );
+
+    // Thread placement of the other native pools (cuts, mfs, worker pool):
+    // thread i is pinned to cpus[i % cpus.length]; empty turns it off. Each
+    // pool reports { cpu, node, status } per thread as above.
+    public static native void Abc_SetThreadCpus( int[] cpus );
+
+    // Compaction: copies the cones of roots (and the manager's POs) into a
+    // new manager, frees the old one and returns the new one. roots is
+    // rewritten in place with the handles of the copies; PIs keep their
+    // order, any other handle into the old manager becomes invalid.
+    public static native long Fraig_ManCompact( long fAig, long[] roots );
+    public static native long Ivy_ManCompact( long fAig, long[] roots );
+
+    // Simulation patterns: resizing rebuilds the manager like Fraig_ManCompact
+    // (and turns on feedback of SAT counter-examples as dynamic patterns),
+    // so only the returned roots stay valid. The filled dynamic words are
+    // kept, truncated to the new width; the random words are drawn anew.
+    // nPatsRand and nPatsDyna below 32 (one word) throw.
+    // Stats are { nWordsRand, nWordsDyna, dynamic words filled, SAT calls,
+    // proofs, counter-examples, undecided }; class counts give the number of
+    // node classes after each simulation word.
+    public static native long Fraig_ManResizeSim( long fAig, long[] roots, int nPatsRand, int nPatsDyna );
+    public static native void Fraig_ManSetFeedBack( long fAig, boolean fFeedBack );
+    public static native int[] Fraig_ManReadSimStats( long fAig );
+    public static native int[] Fraig_ManSimClassCounts( long fAig );
+    public static native long Fraig_ManReadSatConflicts( long fAig );
+
+    // Gia: nodes are int literals (2 * id + complement, 0/1 the constants).
+    // Bulk arrays number variables AIGER-style: 0 constant, 1..nCis the CIs,
+    // then the ANDs; ands holds two fanin literals per node, cos one per CO,
+    // the last nRegs CIs/COs are registers. Import structurally hashes, so
+    // the exported numbering may differ. ToArrays returns
+    // { nCis, nRegs, nAnds, nCos, ands..., cos... }.
+    // The engines (&fraig, &scorr, &dch) return a new manager and leave
+    // their input alone; Gia_ManCec returns 1 equivalent, 0 not, -1 undecided.
+    public static native long Gia_ManStart( int nObjsAlloc );
+    public static native void Gia_ManStop( long gAig );
+    public static native int Gia_ManAppendCi( long gAig );
+    public static native int Gia_ManAppendCo( long gAig, int lit );
+    public static native int Gia_ManHashAnd( long gAig, int litA, int litB );
+    public static native int Gia_ManHashOr( long gAig, int litA, int litB );
+    public static native int Gia_ManHashXor( long gAig, int litA, int litB );
+    public static native int Gia_ManHashMux( long gAig, int litC, int litT, int litE );
+    public static int Gia_LitNot( int lit ) { return lit ^ 1; }
+    public static native int Gia_ManCiNum( long gAig );
+    public static native int Gia_ManCoNum( long gAig );
+    public static native int Gia_ManAndNum( long gAig );
+    public static native int Gia_ManRegNum( long gAig );
+    public static native void Gia_ManSetRegNum( long gAig, int nRegs );
+    public static native int Gia_ManLevelNum( long gAig );
+    public static native long Gia_ManMemory( long gAig );
+    public static native int Gia_ManCoDriver( long gAig, int i );
+    public static native long Gia_ManFromArrays( int nCis, int nRegs, int[] ands, int[] cos );
+    public static native int[] Gia_ManToArrays( long gAig );
+    public static native long Gia_ManFromNtk( long pAig );
+    public static native long Gia_ManToNtk( long gAig );
+    public static native long Gia_ManFraig( long gAig, int nConfLimit );
+    public static native long Gia_ManScorr( long gAig, int nConfLimit );
+    public static native long Gia_ManDch( long gAig, int nConfLimit );
+    public static native int Gia_ManCec( long gAigA, long gAigB, int nConfLimit, int nTimeLimit );
+
+    // Checkpoints for speculative queries on an Ivy manager: rolling back
+    // deletes every object (node, PI, PO) created since the checkpoint, at
+    // a cost proportional to those objects. Checkpoints nest like a stack;
+    // handles of the deleted objects become invalid.
+    public static native int Ivy_ManCheckpoint( long fAig );
+    public static native void Ivy_ManRollback( long fAig, int checkpoint );
+
+    // All solutions of a node with one incremental SAT solver: Start adds
+    // the CNF of the node's cone, each Next writes up to nMax records to
+    // buf (direct, native byte order) and blocks them, so repeated calls
+    // continue the enumeration. A record has one bit per PI of the manager
+    // (PI i in bit i % 64 of long i / 64) and a care mask of the same size
+    // after it. With fCubes, cubes are lifted by justification, so every
+    // completion satisfies the node. Without it, the care mask holds the
+    // PIs of the node's cone: models are projections onto the cone, and
+    // the PIs outside it (value bit 0) are don't care, not enumerated.
+    // Next returns the records written, -1 if buf is not direct; it stops
+    // early if a solve runs out of nConfLimit conflicts (0: no limit).
+    // IsDone tells whether all were found.
+    public static native long Fraig_AllSatStart( long fAig, long fObj, boolean fCubes );
+    public static native long Ivy_AllSatStart( long fAig, long fObj, boolean fCubes );
+    public static native int Abc_AllSatRecordBytes( long pEnum );
+    public static native int Abc_AllSatNext( long pEnum, java.nio.ByteBuffer buf, int nMax, int nConfLimit );
+    public static native boolean Abc_AllSatIsDone( long pEnum );
+    public static native void Abc_AllSatStop( long pEnum );
+
+    // Priority cuts of every AND node, at most nCutsMax (<= 64) cuts of at
+    // most nLeavesMax (2..8) leaves per node, computed level by level on
+    // nThreads threads; the trivial cut is not stored. Records are
+    // Abc_CutsRecordBytes long, written node by node in level order
+    // (direct buffer, native byte order):
+    // { int node, int nLeaves, int leaves[nLeavesMax] (-1 padded), padding
+    // to 8 bytes, long truth[max(1, 2^(nLeavesMax-6))] } with leaf i as
+    // truth table variable i. Node and leaf numbers are object ids.
+    // Abc_CutsWrite returns the records written, -1 if buf is too small.
+    public static native long Abc_NtkCuts( long pAig, int nLeavesMax, int nCutsMax, int nThreads );
+    public static native long Ivy_ManCuts( long fAig, int nLeavesMax, int nCutsMax, int nThreads );
+    public static native long Abc_CutsNum( long pCuts );
+    public static native int Abc_CutsRecordBytes( long pCuts );
+    // { cpu, node, status } per thread (see Abc_SetThreadCpus)
+    public static native int[] Abc_CutsReadPlacement( long pCuts );
+    public static native long Abc_CutsWrite( long pCuts, java.nio.ByteBuffer buf );
+    public static native void Abc_CutsFree( long pCuts );
+
+    // In-process LUT mapping of a strashed network into nLutSize-input
+    // LUTs (2..10), choices used if fChoices. The handle holds the mapped
+    // netlist { nCis, nLuts, nCos, per LUT: nFanins, fanin vars...,
+    // per CO: driver literal } numbered as in Gia_ManToArrays, and the
+    // LUT truth tables, max(1, 2^(nLutSize-6)) longs per LUT. Returns 0
+    // if mapping fails.
+    public static native long Abc_NtkLutMap( long pAig, int nLutSize, int nCutsMax, boolean fArea, boolean fChoices );
+    public static native int Abc_LutMapArea( long pMap );
+    public static native int Abc_LutMapDepth( long pMap );
+    public static native int[] Abc_LutMapNetlist( long pMap );
+    public static native long[] Abc_LutMapTruths( long pMap );
+    public static native void Abc_LutMapFree( long pMap );
+
+    // Cofactor, composition (vars[i] replaced by funcs[i]) and existential
+    // quantification of a cone, built in the same manager. Variables are
+    // regular PI (CI) handles. Fraig results are functionally reduced on
+    // the fly; with nConfLimit > 0, Abc and Ivy quantification runs in a
+    // scratch Fraig manager with that conflict limit and only the reduced
+    // result is copied back. The Abc network must be strashed.
+    public static native long Abc_AigCofactor( long pAig, long pObj, long pVar, boolean fValue );
+    public static native long Abc_AigCompose( long pAig, long pObj, long[] vars, long[] funcs );
+    public static native long Abc_AigExists( long pAig, long pObj, long[] vars, int nConfLimit );
+    public static native long Fraig_NodeCofactor( long fAig, long fObj, long fVar, boolean fValue );
+    public static native long Fraig_NodeCompose( long fAig, long fObj, long[] vars, long[] funcs );
+    public static native long Fraig_NodeExists( long fAig, long fObj, long[] vars );
+    public static native long Ivy_Cofactor( long fAig, long fObj, long fVar, boolean fValue );
+    public static native long Ivy_Compose( long fAig, long fObj, long[] vars, long[] funcs );
+    public static native long Ivy_Exists( long fAig, long fObj, long[] vars, int nConfLimit );
+
+    // Choices. Abc_NtkDch returns a new strashed network with choices
+    // (rewriting snapshots merged by SAT sweeping; conflict limit per
+    // check), which Abc_NtkLutMap can map with fChoices. The choice arrays
+    // are { next[nObjs], repr[nObjs] } over object ids (Fraig node
+    // numbers): next is the following class member or -1, repr is
+    // 2 * reprId + fCompl for class members, -1 for representatives and
+    // nodes without choices. The Fraig manager needs fChoicing.
+    public static native long Abc_NtkDch( long pAig, int nConfLimit, boolean fSynthesis );
+    public static native int Abc_NtkGetChoiceNum( long pAig );
+    public static native int[] Abc_NtkChoiceArrays( long pAig );
+    public static native int[] Fraig_ManChoiceArrays( long fAig );
+
+    // Worker pool: runs Gia engines in abc2java_worker processes (make
+    // worker), each optionally limited to nMemLimitMb of address space,
+    // so a crash or allocation failure costs a job instead of the JVM.
+    // Inputs are copied as Gia arrays into one of nSlots shared memory
+    // slots of nSlotInts ints, which also holds the output. Submit returns
+    // the job (its slot), -1 if no slot is free or the input does not
+    // fit. A fraig/scorr job still running nTimeOutMs after it started
+    // (<= 0: no limit), or a cec job one second past its nTimeLimit, has
+    // its worker killed. Abc_PoolWait gives 1 when done, 0 on timeout
+    // (nTimeOutMs < 0 waits for good), -1 if the worker crashed on the
+    // job, -3 if it was killed; such workers are restarted and their
+    // other jobs moved. Abc_PoolResult is
+    // the cec answer (1, 0, -1), or 1 for fraig/scorr if the output arrays
+    // fit in the slot (Abc_PoolResultArrays/Abc_PoolResultGia). Finished
+    // jobs hold their slot until released.
+    public static native long Abc_PoolStart( String workerPath, int nWorkers, int nSlots, int nSlotInts, int nMemLimitMb );
+    public static native void Abc_PoolStop( long pPool );
+    public static native int Abc_PoolSubmitFraig( long pPool, long gAig, int nConfLimit, int nTimeOutMs );
+    public static native int Abc_PoolSubmitScorr( long pPool, long gAig, int nConfLimit, int nTimeOutMs );
+    public static native int Abc_PoolSubmitCec( long pPool, long gAigA, long gAigB, int nConfLimit, int nTimeLimit );
+    public static native int Abc_PoolWait( long pPool, int job, int nTimeOutMs );
+    public static native int Abc_PoolResult( long pPool, int job );
+    public static native int[] Abc_PoolResultArrays( long pPool, int job );
+    public static native long Abc_PoolResultGia( long pPool, int job );
+    public static native void Abc_PoolRelease( long pPool, int job );
+    public static native int Abc_PoolRestarts( long pPool );
+    // { cpu, node, status } per worker (see Abc_SetThreadCpus)
+    public static native int[] Abc_PoolReadPlacement( long pPool );
+
+    // Don't-care optimization (mfs) of a strashed network, returned as a
+    // new one that is never larger. Combinational networks are split into
+    // output partitions optimized on nThreads threads (at most one per
+    // cpu); partitions not started within nTimeOutMs (<= 0: no limit) are
+    // kept as they are. The budget is only checked between partitions: a
+    // started one runs to the end, bounded by nConfLimit per SAT call (mfs's
+    // default if <= 0 with a budget). A network with latches is a single
+    // partition and ignores the budget.
+    // stats, if not null, gets {nodes before, nodes after, partitions,
+    // partitions optimized, threads}, followed by { cpu, node, status } per
+    // thread (see Abc_SetThreadCpus) as far as it is long enough; a stats
+    // array shorter than the 5 header ints throws.
+    public static native long Abc_NtkMfs( long pAig, int nWinTfoLevs, int nFanoutsMax, int nConfLimit, int nThreads, int nTimeOutMs, int[] stats );
+
+    // Tracing (libabc2java built with TRACE=1): calls per JNI entry point
+    // since the last reset, and latency histograms of the heavy ones.
+    // Without tracing all of these return empty arrays.
+    public static native boolean Abc_TraceEnabled();
+    public static native String[] Abc_TraceNames();
+    public static native long[] Abc_TraceCounts();
+    public static native long[] Abc_TraceHistogram( int id );
+    // entry points that got no counter or histogram because a cap was hit
+    public static native int Abc_TraceDropped();
+    public static native void Abc_TraceReset();
+
+    // lower bound in ns of a histogram bucket: 16 linear buckets, then
+    // 8 sub-buckets per power of 2
+    public static long Abc_TraceBucketLowNs( int b ) {
+        if (b < 16) {
+            return b;
+        }
+        int e = 4 + (b - 16) / 8;
+        return (8L + (b - 16) % 8) << (e - 3);
+    }
+
 
     // Fraig
     public static native long Fraig_ManCreate( long fParams );
@@ -86,15 +427,15 @@ public final class Abc {
     public static native long Fraig_ManReadIthVar( long fAig, int i );
     public static native long Fraig_NodeAnd( long fAig, long fObjA, long fObjB );
     public static native long Fraig_NodeOr( long fAig, long fObjA, long fObjB );
-    public static native long Fraig_Not( long fObj );
+    public static long Fraig_Not( long fObj ) { return fObj ^ 1L; }
 
     public static native int Fraig_ManReadInputNum( long fAig );
 
-    public static native long Fraig_Regular( long fObj );
+    public static long Fraig_Regular( long fObj ) { return fObj & ~1L; }
     public static native int Fraig_NodeReadNum( long fObj );
 
     public static native boolean Fraig_NodeIsVar( long fObj );
-    public static native boolean Fraig_IsComplement( long fObj );
+    public static boolean Fraig_IsComplement( long fObj ) { return (fObj & 1L) != 0; }
     public static native boolean Fraig_NodeIsConst( long fObj );
 
     public static native long Fraig_NodeReadOne( long fObj );
@@ -125,6 +466,19 @@ public final class Abc {
     public static native void Fraig_ParamsSet_nConfLimit( long fParams, int n );
     public static native void Fraig_ParamsSet_nInspLimit( long fParams, int n );
 
+    // Fraig literal handles; a literal of no node (or ReadOne/ReadTwo of a
+    // non-AND node) throws
+    public static native int Fraig_ManReadNodeNum( long fAig );
+    public static native int Fraig_NodeToLit( long fObj );
+    public static native long Fraig_ManNodeFromLit( long fAig, int lit );
+    public static native int Fraig_ManReadConst1Lit( long fAig );
+    public static native int Fraig_ManReadIthVarLit( long fAig, int i );
+    public static native int Fraig_NodeAndLit( long fAig, int litA, int litB );
+    public static native int Fraig_NodeOrLit( long fAig, int litA, int litB );
+    public static native int Fraig_NodeReadOneLit( long fAig, int lit );
+    public static native int Fraig_NodeReadTwoLit( long fAig, int lit );
+    public static native boolean Fraig_NodesAreEqualLit( long fAig, int litA, int litB, int nBTLimit, int nTimeLimit );
+
 
     // Ivy Aig
     public static native long Ivy_ManStart();
@@ -134,15 +488,16 @@ public final class Abc {
     public static native long Ivy_ObjCreatePi( long fAig );
     public static native long Ivy_And( long fAig, long fObjA, long fObjB );
     public static native long Ivy_Or( long fAig, long fObjA, long fObjB );
-    public static native long Ivy_Not( long fObj );
+    public static native long Ivy_ObjCreatePo( long fAig, long fObj );
+    public static long Ivy_Not( long fObj ) { return fObj ^ 1L; }
 
     public static native int Ivy_ManPiNum( long fAig );
 
-    public static native long Ivy_Regular( long fObj );
+    public static long Ivy_Regular( long fObj ) { return fObj & ~1L; }
     public static native int Ivy_ObjId( long fObj );
 
     public static native boolean Ivy_ObjIsPi( long fObj );
-    public static native boolean Ivy_IsComplement( long fObj );
+    public static boolean Ivy_IsComplement( long fObj ) { return (fObj & 1L) != 0; }
     public static native boolean Ivy_ObjIsConst1( long fObj );
 
     public static native long Ivy_ObjChild0( long fObj );
@@ -156,6 +511,18 @@ public final class Abc {
 
     public static native boolean Ivy_ManCheck( long fAig );
 
+    // Ivy literal handles; a literal of no object, a deleted one, or the
+    // child of an object without that fanin throws
+    public static native int Ivy_ManObjIdMax( long fAig );
+    public static native int Ivy_ObjToLit( long fObj );
+    public static native long Ivy_ManObjFromLit( long fAig, int lit );
+    public static native int Ivy_ManConst1Lit( long fAig );
+    public static native int Ivy_ObjCreatePiLit( long fAig );
+    public static native int Ivy_AndLit( long fAig, int litA, int litB );
+    public static native int Ivy_OrLit( long fAig, int litA, int litB );
+    public static native int Ivy_ObjChild0Lit( long fAig, int lit );
+    public static native int Ivy_ObjChild1Lit( long fAig, int lit );
+
     public static void main(String[] args){
         System.err.println("Abc ready? " + isReady());
         System.err.println("Abc Java Bindings Version " + versionString);
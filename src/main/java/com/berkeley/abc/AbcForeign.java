@@ -0,0 +1,112 @@
+package com.berkeley.abc;
+
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.Linker;
+import java.lang.foreign.SymbolLookup;
+import java.lang.invoke.MethodHandle;
+
+import static java.lang.foreign.ValueLayout.JAVA_INT;
+import static java.lang.foreign.ValueLayout.JAVA_LONG;
+
+/*
+ * java.lang.foreign (Panama) downcalls for the small read-only accessors.
+ *
+ * These bind the plain C abc2java_* entry points of libabc2java as
+ * critical downcalls, which skip the JNI frame and thread-state
+ * transition of the equivalent Abc natives. Requires JDK 22 or later;
+ * build with ABC_FOREIGN=1 and run with --enable-native-access.
+ *
+ * The pure pointer-bit accessors (Not/Regular/IsComplement) are plain
+ * Java in Abc and need no downcall at all.
+ */
+public final class AbcForeign {
+    private static final Linker linker = Linker.nativeLinker();
+    private static final SymbolLookup lookup;
+
+    static {
+        // loads libabc2java through Abc's static initializer
+        if (!Abc.isReady()) {
+            throw new UnsatisfiedLinkError("libabc2java is not loaded");
+        }
+        lookup = SymbolLookup.loaderLookup();
+    }
+
+    private AbcForeign() { }
+
+    private static MethodHandle downcall( String name, FunctionDescriptor fd ) {
+        return linker.downcallHandle(
+            lookup.find(name).orElseThrow(() -> new UnsatisfiedLinkError(name)),
+            fd, Linker.Option.critical(false));
+    }
+
+    private static final FunctionDescriptor J_J = FunctionDescriptor.of(JAVA_LONG, JAVA_LONG);
+    private static final FunctionDescriptor I_J = FunctionDescriptor.of(JAVA_INT, JAVA_LONG);
+
+    private static final MethodHandle abc_ObjId           = downcall("abc2java_Abc_ObjId", J_J);
+    private static final MethodHandle abc_ObjIsCi         = downcall("abc2java_Abc_ObjIsCi", I_J);
+    private static final MethodHandle abc_AigNodeIsConst  = downcall("abc2java_Abc_AigNodeIsConst", I_J);
+    private static final MethodHandle abc_ObjFanin0       = downcall("abc2java_Abc_ObjFanin0", J_J);
+    private static final MethodHandle abc_ObjFanin1       = downcall("abc2java_Abc_ObjFanin1", J_J);
+    private static final MethodHandle abc_ObjFaninC0      = downcall("abc2java_Abc_ObjFaninC0", I_J);
+    private static final MethodHandle abc_ObjFaninC1      = downcall("abc2java_Abc_ObjFaninC1", I_J);
+    private static final MethodHandle abc_ObjChild0       = downcall("abc2java_Abc_ObjChild0", J_J);
+    private static final MethodHandle abc_ObjChild1       = downcall("abc2java_Abc_ObjChild1", J_J);
+
+    private static final MethodHandle fraig_NodeReadNum   = downcall("abc2java_Fraig_NodeReadNum", I_J);
+    private static final MethodHandle fraig_NodeIsVar     = downcall("abc2java_Fraig_NodeIsVar", I_J);
+    private static final MethodHandle fraig_NodeIsConst   = downcall("abc2java_Fraig_NodeIsConst", I_J);
+    private static final MethodHandle fraig_NodeReadOne   = downcall("abc2java_Fraig_NodeReadOne", J_J);
+    private static final MethodHandle fraig_NodeReadTwo   = downcall("abc2java_Fraig_NodeReadTwo", J_J);
+
+    private static final MethodHandle ivy_ObjId           = downcall("abc2java_Ivy_ObjId", I_J);
+    private static final MethodHandle ivy_ObjIsPi         = downcall("abc2java_Ivy_ObjIsPi", I_J);
+    private static final MethodHandle ivy_ObjIsConst1     = downcall("abc2java_Ivy_ObjIsConst1", I_J);
+    private static final MethodHandle ivy_ObjChild0       = downcall("abc2java_Ivy_ObjChild0", J_J);
+    private static final MethodHandle ivy_ObjChild1       = downcall("abc2java_Ivy_ObjChild1", J_J);
+    private static final MethodHandle ivy_ObjEquiv        = downcall("abc2java_Ivy_ObjEquiv", J_J);
+
+    private static long callJ( MethodHandle h, long p ) {
+        try {
+            return (long) h.invokeExact(p);
+        } catch (Throwable t) {
+            throw new AssertionError(t);
+        }
+    }
+
+    private static int callI( MethodHandle h, long p ) {
+        try {
+            return (int) h.invokeExact(p);
+        } catch (Throwable t) {
+            throw new AssertionError(t);
+        }
+    }
+
+
+    // Aig
+    public static long Abc_ObjId( long pObj )               { return callJ(abc_ObjId, pObj); }
+    public static boolean Abc_ObjIsCi( long pObj )          { return callI(abc_ObjIsCi, pObj) != 0; }
+    public static boolean Abc_AigNodeIsConst( long pObj )   { return callI(abc_AigNodeIsConst, pObj) != 0; }
+    public static long Abc_ObjFanin0( long pObj )           { return callJ(abc_ObjFanin0, pObj); }
+    public static long Abc_ObjFanin1( long pObj )           { return callJ(abc_ObjFanin1, pObj); }
+    public static boolean Abc_ObjFaninC0( long pObj )       { return callI(abc_ObjFaninC0, pObj) != 0; }
+    public static boolean Abc_ObjFaninC1( long pObj )       { return callI(abc_ObjFaninC1, pObj) != 0; }
+    public static long Abc_ObjChild0( long pObj )           { return callJ(abc_ObjChild0, pObj); }
+    public static long Abc_ObjChild1( long pObj )           { return callJ(abc_ObjChild1, pObj); }
+
+
+    // Fraig
+    public static int Fraig_NodeReadNum( long fObj )        { return callI(fraig_NodeReadNum, fObj); }
+    public static boolean Fraig_NodeIsVar( long fObj )      { return callI(fraig_NodeIsVar, fObj) != 0; }
+    public static boolean Fraig_NodeIsConst( long fObj )    { return callI(fraig_NodeIsConst, fObj) != 0; }
+    public static long Fraig_NodeReadOne( long fObj )       { return callJ(fraig_NodeReadOne, fObj); }
+    public static long Fraig_NodeReadTwo( long fObj )       { return callJ(fraig_NodeReadTwo, fObj); }
+
+
+    // Ivy Aig
+    public static int Ivy_ObjId( long fObj )                { return callI(ivy_ObjId, fObj); }
+    public static boolean Ivy_ObjIsPi( long fObj )          { return callI(ivy_ObjIsPi, fObj) != 0; }
+    public static boolean Ivy_ObjIsConst1( long fObj )      { return callI(ivy_ObjIsConst1, fObj) != 0; }
+    public static long Ivy_ObjChild0( long fObj )           { return callJ(ivy_ObjChild0, fObj); }
+    public static long Ivy_ObjChild1( long fObj )           { return callJ(ivy_ObjChild1, fObj); }
+    public static long Ivy_ObjEquiv( long fObj )            { return callJ(ivy_ObjEquiv, fObj); }
+}
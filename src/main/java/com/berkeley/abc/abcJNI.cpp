@@ -3,12 +3,45 @@
 #include <stdio.h>
 #include <new>
 #include <limits>
+#include <algorithm>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <string.h>
+#include <stdint.h>
+#include <atomic>
 
 #include "com_berkeley_abc_Abc.h"
 #include "base/main/main.h"
 #include "proof/fraig/fraig.h"
 #include "proof/fraig/fraigInt.h"
 #include "aig/ivy/ivy.h"
+#include "aig/aig/aig.h"
+#include "sat/cnf/cnf.h"
+#include "proof/pdr/pdr.h"
+#include "sat/bmc/bmc.h"
+#include "aig/saig/saig.h"
+#include "aig/gia/giaAig.h"
+#include "proof/cec/cec.h"
+#include "proof/dch/dch.h"
+#include "sat/bsat/satSolver.h"
+#include "misc/util/utilTruth.h"
+#include "map/if/if.h"
+#include "opt/mfs/mfs.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +49,15 @@ extern "C" {
 
 Fraig_Params_t Params;
 Ivy_FraigParams_t iParams;
+Pdr_Par_t pdrParams;
+Saig_ParBmc_t bmcParams;
+
+// defined in base/abci/abcDar.c
+extern Aig_Man_t * Abc_NtkToDar( Abc_Ntk_t * pNtk, int fExors, int fRegisters );
+extern Abc_Ntk_t * Abc_NtkFromAigPhase( Aig_Man_t * pMan );
+extern Abc_Ntk_t * Abc_NtkDch( Abc_Ntk_t * pNtk, Dch_Pars_t * pPars );
+// defined in base/abci/abcIf.c
+extern If_Man_t * Abc_NtkToIf( Abc_Ntk_t * pNtk, If_Par_t * pPars );
 
 /*
  * Out-of-memory handler: throws a C++ exception
@@ -61,6 +103,7 @@ static void standard_exception(JNIEnv *env) {
   jint code;
 
   code = 0;
+  e = env->FindClass("java/lang/RuntimeException");
 
   if (e != NULL) {
     code = env->ThrowNew(e, "Standard error in ABC JNI.");
@@ -90,28 +133,267 @@ static jstring convertToString(JNIEnv *env, const char *s) {
   return b;
 }
 
+/*
+ * Copies a vector of ints into a new Java array and frees the vector.
+ */
+static jintArray convertToIntArray(JNIEnv *env, Vec_Int_t *v) {
+  jintArray b = env->NewIntArray(Vec_IntSize(v));
+
+  if (b == NULL) {
+    out_of_mem_exception(env);
+  } else {
+    env->SetIntArrayRegion(b, 0, Vec_IntSize(v), Vec_IntArray(v));
+  }
+  Vec_IntFree(v);
+  return b;
+}
+
+/*
+ * Entry point tracing, compiled in with -DABC2JAVA_TRACE (make TRACE=1).
+ *
+ * Every JNI function starts with ABC2JAVA_TRACE_CALL, or ABC2JAVA_TRACE_TIMED
+ * for the heavy ones, which also records its latency in a log-linear
+ * histogram: 16 linear buckets below 16ns, then 8 sub-buckets per power of 2.
+ * Each thread bumps its own block of counters with plain relaxed stores;
+ * blocks are never freed, only handed to the next thread when their owner
+ * exits, so the totals survive thread churn. Readers sum all blocks, and a
+ * reset only moves the baseline that snapshots are taken against.
+ * Without ABC2JAVA_TRACE the macros expand to nothing.
+ *
+ * Points and histogram slots are handed out in order of first call, so
+ * the caps must cover every ABC2JAVA_TRACE_CALL/ABC2JAVA_TRACE_TIMED site
+ * (about 250 and 45 now); a site past a cap is counted in
+ * Abc_TraceDropped instead of being lost silently.
+ */
+#ifdef ABC2JAVA_TRACE
+
+#define ABC2JAVA_TRACE_POINTS    512
+#define ABC2JAVA_TRACE_TIMED_MAX 64
+#define ABC2JAVA_TRACE_BUCKETS   368
+
+typedef struct abc2java_TracePoint_t_ { int Id; int Slot; } abc2java_TracePoint_t;
+typedef struct abc2java_TraceBlock_t_ abc2java_TraceBlock_t;
+
+struct abc2java_TraceBlock_t_
+{
+    std::atomic<int>        fInUse;
+    abc2java_TraceBlock_t * pNext;
+    std::atomic<uint64_t>   Counts[ABC2JAVA_TRACE_POINTS];
+    std::atomic<uint64_t>   Hist[ABC2JAVA_TRACE_TIMED_MAX][ABC2JAVA_TRACE_BUCKETS];
+};
+
+struct abc2java_TraceTls_t
+{
+    abc2java_TraceBlock_t * pBlock;
+    ~abc2java_TraceTls_t() { if ( pBlock ) pBlock->fInUse.store( 0, std::memory_order_release ); }
+};
+
+static pthread_mutex_t abc2java_TraceMutex = PTHREAD_MUTEX_INITIALIZER;
+static const char * abc2java_TraceNames[ABC2JAVA_TRACE_POINTS];
+static int abc2java_TraceSlots[ABC2JAVA_TRACE_POINTS];
+static std::atomic<int> abc2java_TraceNum( 0 );
+static int abc2java_TraceTimedNum = 0;
+static int abc2java_TraceDropped = 0;     // sites without a point or a histogram
+static std::atomic<abc2java_TraceBlock_t *> abc2java_TraceBlocks( NULL );
+static uint64_t abc2java_TraceBaseCounts[ABC2JAVA_TRACE_POINTS];
+static uint64_t abc2java_TraceBaseHist[ABC2JAVA_TRACE_TIMED_MAX][ABC2JAVA_TRACE_BUCKETS];
+static thread_local abc2java_TraceTls_t abc2java_TraceTls;
+
+// called once per trace point, from the guarded static initializer
+static abc2java_TracePoint_t abc2java_TraceRegister( const char * pName, int fTimed )
+{
+    abc2java_TracePoint_t Point = { -1, -1 };
+    int Id;
+    pthread_mutex_lock( &abc2java_TraceMutex );
+    Id = abc2java_TraceNum.load( std::memory_order_relaxed );
+    if ( Id < ABC2JAVA_TRACE_POINTS )
+    {
+        abc2java_TraceNames[Id] = pName;
+        abc2java_TraceSlots[Id] = -1;
+        if ( fTimed && abc2java_TraceTimedNum < ABC2JAVA_TRACE_TIMED_MAX )
+            abc2java_TraceSlots[Id] = abc2java_TraceTimedNum++;
+        else if ( fTimed )
+            abc2java_TraceDropped++;
+        Point.Id = Id;
+        Point.Slot = abc2java_TraceSlots[Id];
+        abc2java_TraceNum.store( Id + 1, std::memory_order_release );
+    }
+    else
+        abc2java_TraceDropped++;
+    pthread_mutex_unlock( &abc2java_TraceMutex );
+    return Point;
+}
+
+static abc2java_TraceBlock_t * abc2java_TraceBlockAcquire()
+{
+    abc2java_TraceBlock_t * p;
+    int fFree;
+    for ( p = abc2java_TraceBlocks.load( std::memory_order_acquire ); p; p = p->pNext )
+    {
+        fFree = 0;
+        if ( p->fInUse.compare_exchange_strong( fFree, 1, std::memory_order_acquire ) )
+            return p;
+    }
+    p = new abc2java_TraceBlock_t();
+    p->fInUse.store( 1, std::memory_order_relaxed );
+    p->pNext = abc2java_TraceBlocks.load( std::memory_order_relaxed );
+    while ( !abc2java_TraceBlocks.compare_exchange_weak( p->pNext, p, std::memory_order_release ) );
+    return p;
+}
+
+static inline abc2java_TraceBlock_t * abc2java_TraceBlock()
+{
+    if ( abc2java_TraceTls.pBlock == NULL )
+        abc2java_TraceTls.pBlock = abc2java_TraceBlockAcquire();
+    return abc2java_TraceTls.pBlock;
+}
+
+// only the owning thread writes, so no read-modify-write is needed
+static inline void abc2java_TraceBump( std::atomic<uint64_t> & Counter )
+{
+    Counter.store( Counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+}
+
+static inline void abc2java_TraceCount( abc2java_TracePoint_t Point )
+{
+    if ( Point.Id >= 0 )
+        abc2java_TraceBump( abc2java_TraceBlock()->Counts[Point.Id] );
+}
+
+static inline uint64_t abc2java_TraceNow()
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline int abc2java_TraceBucket( uint64_t Ns )
+{
+    int e;
+    if ( Ns < 16 )
+        return (int)Ns;
+    e = 63 - __builtin_clzll( Ns );
+    if ( e > 47 )
+        return ABC2JAVA_TRACE_BUCKETS - 1;
+    return 16 + (e - 4) * 8 + (int)((Ns >> (e - 3)) & 7);
+}
+
+class abc2java_TraceTimer
+{
+public:
+    abc2java_TraceTimer( abc2java_TracePoint_t Point ) : m_Point( Point ), m_Start( abc2java_TraceNow() ) {}
+    ~abc2java_TraceTimer()
+    {
+        if ( m_Point.Slot >= 0 )
+            abc2java_TraceBump( abc2java_TraceBlock()->Hist[m_Point.Slot][abc2java_TraceBucket(abc2java_TraceNow() - m_Start)] );
+    }
+private:
+    abc2java_TracePoint_t m_Point;
+    uint64_t m_Start;
+};
+
+#define ABC2JAVA_TRACE_CALL() \
+    static const abc2java_TracePoint_t abc2java_TP = abc2java_TraceRegister( __func__, 0 ); \
+    abc2java_TraceCount( abc2java_TP )
+#define ABC2JAVA_TRACE_TIMED() \
+    static const abc2java_TracePoint_t abc2java_TP = abc2java_TraceRegister( __func__, 1 ); \
+    abc2java_TraceCount( abc2java_TP ); \
+    abc2java_TraceTimer abc2java_TT( abc2java_TP )
+
+#else
+
+#define ABC2JAVA_TRACE_CALL()
+#define ABC2JAVA_TRACE_TIMED()
+
+#endif
+
+
 //////////////////////////////////////
 // AIG
 //////////////////////////////////////
 
 /*
  * GLOBAL INITIALIZATION/EXIT/RESET
+ *
+ * Abc_Start sets up the full frame with the command tables of every ABC
+ * package, which links in all of libabc. Fraig, Ivy, Aig and CNF need no
+ * commands, so Abc_StartLean only allocates the global frame. A library
+ * built with ABC2JAVA_LEAN (make lean) has no network APIs and always
+ * starts lean.
  */
+static int abc2java_fLeanFrame = 0;
+
+#ifndef ABC2JAVA_LEAN
+static void abc2java_PortRunsJoin( void * pOwner, int fAll );
+#endif
+
+// a frame already there, lean or full, is kept as it is
+static void abc2java_StartLean()
+{
+    if ( Abc_FrameReadGlobalFrame() != NULL )
+        return;
+    Abc_FrameSetGlobalFrame( Abc_FrameAllocate() );
+    abc2java_fLeanFrame = 1;
+}
+
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1Start
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+#ifdef ABC2JAVA_LEAN
+    abc2java_StartLean();
+#else
+    // a lean frame has no command tables, so it is replaced by a full one
+    if (abc2java_fLeanFrame) {
+        abc2java_PortRunsJoin( NULL, 1 );
+        Abc_FrameDeallocate( Abc_FrameReadGlobalFrame() );
+        Abc_FrameSetGlobalFrame( NULL );
+    }
     Abc_Start();
+    abc2java_fLeanFrame = 0;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1StartLean
+  (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_StartLean();
 }
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1Stop
   (JNIEnv *env, jclass) {
-    Abc_Stop();
+    ABC2JAVA_TRACE_CALL();
+#ifndef ABC2JAVA_LEAN
+    // portfolio engines still running use the frame
+    abc2java_PortRunsJoin( NULL, 1 );
+#endif
+    if (abc2java_fLeanFrame) {
+        if ( Abc_FrameReadGlobalFrame() )
+            Abc_FrameDeallocate( Abc_FrameReadGlobalFrame() );
+        abc2java_fLeanFrame = 0;
+    } else {
+#ifndef ABC2JAVA_LEAN
+        Abc_Stop();
+#endif
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1IsLean
+  (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+#ifdef ABC2JAVA_LEAN
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
 }
 
+#ifndef ABC2JAVA_LEAN
 /*
  * NETWORK INITIALIZATION/EXIT/RESET
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkAlloc
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -124,6 +406,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkAlloc
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkDelete
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_TIMED();
     try {
         Abc_NtkDelete( reinterpret_cast<Abc_Ntk_t *>(pAig));
     } catch (std::bad_alloc &ba) {
@@ -136,6 +419,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkDelete
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigConst1
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -148,6 +432,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigConst1
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateNodeConst0
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -160,6 +445,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateNodeConst0
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateNodeConst1
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -172,6 +458,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateNodeConst1
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreatePi
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -184,6 +471,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreatePi
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreatePo
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -194,26 +482,85 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreatePo
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigAnd
-  (JNIEnv *env, jclass, jlong pAig, jlong pObjA, jlong pObjB) {
+/*
+ * Creates a latch with its BI/BO terminals, initialized to 0.
+ * The BO (Abc_LatchOutput) is the current-state CI used in the AIG;
+ * the next-state function is connected to the BI (Abc_LatchInput).
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateLatch
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Abc_Obj_t *pLatch;
 
     try {
-        result = reinterpret_cast<jlong>(Abc_AigAnd( reinterpret_cast<Abc_Aig_t *>(reinterpret_cast<Abc_Ntk_t *>(pAig)->pManFunc),
-                                                     reinterpret_cast<Abc_Obj_t *>(pObjA),
-                                                     reinterpret_cast<Abc_Obj_t *>(pObjB) ));
+        pLatch = Abc_NtkCreateLatch( pNtk );
+        Abc_ObjAddFanin( pLatch, Abc_NtkCreateBi( pNtk ) );
+        Abc_ObjAddFanin( Abc_NtkCreateBo( pNtk ), pLatch );
+        Abc_LatchSetInit0( pLatch );
+        result = reinterpret_cast<jlong>(pLatch);
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigOr
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1LatchOutput
+  (JNIEnv *env, jclass, jlong pLatch) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Abc_ObjFanout0( reinterpret_cast<Abc_Obj_t *>(pLatch) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1LatchInput
+  (JNIEnv *env, jclass, jlong pLatch) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Abc_ObjFanin0( reinterpret_cast<Abc_Obj_t *>(pLatch) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Sets the initial value of a latch: 0, 1, or anything else for don't-care.
+ */
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1LatchSetInit
+  (JNIEnv *env, jclass, jlong pLatch, jint value) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Obj_t *pObj = reinterpret_cast<Abc_Obj_t *>(pLatch);
+
+    try {
+        if (value == 0) {
+            Abc_LatchSetInit0( pObj );
+        } else if (value == 1) {
+            Abc_LatchSetInit1( pObj );
+        } else {
+            Abc_LatchSetInitDc( pObj );
+        }
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigAnd
   (JNIEnv *env, jclass, jlong pAig, jlong pObjA, jlong pObjB) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Abc_AigOr( reinterpret_cast<Abc_Aig_t *>(reinterpret_cast<Abc_Ntk_t *>(pAig)->pManFunc),
+        result = reinterpret_cast<jlong>(Abc_AigAnd( reinterpret_cast<Abc_Aig_t *>(reinterpret_cast<Abc_Ntk_t *>(pAig)->pManFunc),
                                                      reinterpret_cast<Abc_Obj_t *>(pObjA),
                                                      reinterpret_cast<Abc_Obj_t *>(pObjB) ));
     } catch (std::bad_alloc &ba) {
@@ -222,12 +569,15 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigOr
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjNot
-  (JNIEnv *env, jclass, jlong pObj) {
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigOr
+  (JNIEnv *env, jclass, jlong pAig, jlong pObjA, jlong pObjB) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Abc_ObjNot( reinterpret_cast<Abc_Obj_t *>(pObj) ));
+        result = reinterpret_cast<jlong>(Abc_AigOr( reinterpret_cast<Abc_Aig_t *>(reinterpret_cast<Abc_Ntk_t *>(pAig)->pManFunc),
+                                                     reinterpret_cast<Abc_Obj_t *>(pObjA),
+                                                     reinterpret_cast<Abc_Obj_t *>(pObjB) ));
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
@@ -236,6 +586,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjNot
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjAddFanin
   (JNIEnv *env, jclass, jlong pObjO, jlong pObjI) {
+    ABC2JAVA_TRACE_CALL();
     try {
         Abc_ObjAddFanin( reinterpret_cast<Abc_Obj_t *>(pObjO),
                          reinterpret_cast<Abc_Obj_t *>(pObjI) );
@@ -249,6 +600,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjAddFanin
  */
 JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPiNum
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jint result = 0;
 
     try {
@@ -261,6 +613,7 @@ JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPiNum
 
 JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPoNum
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     jint result = 0;
 
     try {
@@ -271,29 +624,33 @@ JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPoNum
     return result;
 }
 
-JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1AigPrintNode
-  (JNIEnv *env, jclass, jlong pObj) {
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkLatchNum
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
     try {
-        Abc_AigPrintNode( reinterpret_cast<Abc_Obj_t *>(pObj) );
+        result = Abc_NtkLatchNum( reinterpret_cast<Abc_Ntk_t *>(pAig) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
+    return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjRegular
-  (JNIEnv *env, jclass, jlong pObj) {
-    jlong result = 0;
 
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1AigPrintNode
+  (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     try {
-        result = reinterpret_cast<jlong>(Abc_ObjRegular( reinterpret_cast<Abc_Obj_t *>(pObj) ));
+        Abc_AigPrintNode( reinterpret_cast<Abc_Obj_t *>(pObj) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
-    return result;
 }
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjId
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     unsigned result = 0;
 
     try {
@@ -306,6 +663,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjId
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjAssignName
   (JNIEnv *env, jclass, jlong pObj, jstring name) {
+    ABC2JAVA_TRACE_CALL();
     const char *s = env->GetStringUTFChars(name, NULL);
 
     if (name == NULL) {
@@ -322,6 +680,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjAssignName
 
 JNIEXPORT jstring JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjName
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     char *s;
     jstring result;
 
@@ -334,8 +693,167 @@ JNIEXPORT jstring JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjName
     return result;
 }
 
+/*
+ * BULK NAMES
+ *
+ * Names are passed as one UTF-8 buffer: name i is buf[offsets[i]..offsets[i+1]),
+ * without terminators, so offsets has one entry more than there are objects.
+ */
+
+// offsets of nNames names start at 0 or more, never decrease and end within the buffer
+static int abc2java_NameOffsetsValid( const jint * pOffsets, int nNames, int nBuf )
+{
+    int i;
+    if ( pOffsets[0] < 0 || pOffsets[nNames] > nBuf )
+        return 0;
+    for ( i = 0; i < nNames; i++ )
+        if ( pOffsets[i] > pOffsets[i+1] )
+            return 0;
+    return 1;
+}
+
+// returns name i of the packed buffer as a C string kept in vName
+static char * abc2java_NameAt( const jbyte * pBuf, const jint * pOffsets, int i, Vec_Str_t * vName )
+{
+    int k;
+    Vec_StrClear( vName );
+    for ( k = pOffsets[i]; k < pOffsets[i+1]; k++ )
+        Vec_StrPush( vName, (char)pBuf[k] );
+    Vec_StrPush( vName, 0 );
+    return Vec_StrArray( vName );
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkAssignNames
+  (JNIEnv *env, jclass, jlong pAig, jlongArray objs, jbyteArray buf, jintArray offsets) {
+    ABC2JAVA_TRACE_CALL();
+    int i, nObjs = env->GetArrayLength(objs);
+    jlong *pObjs = env->GetLongArrayElements(objs, NULL);
+    jbyte *pBuf = env->GetByteArrayElements(buf, NULL);
+    jint *pOffsets = env->GetIntArrayElements(offsets, NULL);
+    Vec_Str_t *vName;
+
+    if (pObjs == NULL || pBuf == NULL || pOffsets == NULL) {
+        out_of_mem_exception(env);
+    } else if (env->GetArrayLength(offsets) != nObjs + 1 ||
+               !abc2java_NameOffsetsValid(pOffsets, nObjs, env->GetArrayLength(buf))) {
+        standard_exception(env);
+    } else {
+        try {
+            vName = Vec_StrAlloc( 100 );
+            for ( i = 0; i < nObjs; i++ )
+                Abc_ObjAssignName( reinterpret_cast<Abc_Obj_t *>(pObjs[i]), abc2java_NameAt(pBuf, pOffsets, i, vName), NULL );
+            Vec_StrFree( vName );
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pOffsets != NULL) env->ReleaseIntArrayElements(offsets, pOffsets, JNI_ABORT);
+    if (pBuf != NULL) env->ReleaseByteArrayElements(buf, pBuf, JNI_ABORT);
+    if (pObjs != NULL) env->ReleaseLongArrayElements(objs, pObjs, JNI_ABORT);
+}
+
+/*
+ * Names of objs packed into one byte[]; offsets (one entry more than objs)
+ * receives the bounds of each name.
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkReadNames
+  (JNIEnv *env, jclass, jlong pAig, jlongArray objs, jintArray offsets) {
+    ABC2JAVA_TRACE_CALL();
+    jbyteArray result = NULL;
+    int i, nObjs = env->GetArrayLength(objs);
+    jlong *pObjs;
+    jint *pOffsets;
+    Vec_Str_t *vNames;
+
+    if (env->GetArrayLength(offsets) != nObjs + 1) {
+        standard_exception(env);
+        return NULL;
+    }
+    pObjs = env->GetLongArrayElements(objs, NULL);
+    pOffsets = env->GetIntArrayElements(offsets, NULL);
+    if (pObjs == NULL || pOffsets == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        try {
+            vNames = Vec_StrAlloc( 16 * nObjs + 16 );
+            pOffsets[0] = 0;
+            for ( i = 0; i < nObjs; i++ )
+            {
+                Vec_StrPrintStr( vNames, Abc_ObjName( reinterpret_cast<Abc_Obj_t *>(pObjs[i]) ) );
+                pOffsets[i+1] = Vec_StrSize( vNames );
+            }
+            result = env->NewByteArray(Vec_StrSize(vNames));
+            if (result == NULL) {
+                out_of_mem_exception(env);
+            } else {
+                env->SetByteArrayRegion(result, 0, Vec_StrSize(vNames), (jbyte *)Vec_StrArray(vNames));
+            }
+            Vec_StrFree( vNames );
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pOffsets != NULL) env->ReleaseIntArrayElements(offsets, pOffsets, 0);
+    if (pObjs != NULL) env->ReleaseLongArrayElements(objs, pObjs, JNI_ABORT);
+    return result;
+}
+
+/*
+ * Looks names up in the network's name table, among the CIs (PIs and
+ * latch outputs) or the COs; a missing name gives 0.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkFindObjs
+  (JNIEnv *env, jclass, jlong pAig, jbyteArray buf, jintArray offsets, jboolean fCos) {
+    ABC2JAVA_TRACE_CALL();
+    jlongArray result = NULL;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    int i, nNames = env->GetArrayLength(offsets) - 1;
+    jbyte *pBuf;
+    jint *pOffsets;
+    jlong *pObjs = NULL;
+    Vec_Str_t *vName;
+    char *pName;
+
+    if (nNames < 0) {
+        standard_exception(env);
+        return NULL;
+    }
+    pBuf = env->GetByteArrayElements(buf, NULL);
+    pOffsets = env->GetIntArrayElements(offsets, NULL);
+    if (pBuf == NULL || pOffsets == NULL) {
+        out_of_mem_exception(env);
+    } else if (!abc2java_NameOffsetsValid(pOffsets, nNames, env->GetArrayLength(buf))) {
+        standard_exception(env);
+    } else {
+        try {
+            pObjs = ABC_ALLOC( jlong, nNames + 1 );
+            vName = Vec_StrAlloc( 100 );
+            for ( i = 0; i < nNames; i++ )
+            {
+                pName = abc2java_NameAt( pBuf, pOffsets, i, vName );
+                pObjs[i] = reinterpret_cast<jlong>( fCos ? Abc_NtkFindCo(pNtk, pName) : Abc_NtkFindCi(pNtk, pName) );
+            }
+            Vec_StrFree( vName );
+            result = env->NewLongArray(nNames);
+            if (result == NULL) {
+                out_of_mem_exception(env);
+            } else {
+                env->SetLongArrayRegion(result, 0, nNames, pObjs);
+            }
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    ABC_FREE( pObjs );
+    if (pOffsets != NULL) env->ReleaseIntArrayElements(offsets, pOffsets, JNI_ABORT);
+    if (pBuf != NULL) env->ReleaseByteArrayElements(buf, pBuf, JNI_ABORT);
+    return result;
+}
+
+
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1AigCleanup
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
     try {
         Abc_AigCleanup( reinterpret_cast<Abc_Aig_t *>(reinterpret_cast<Abc_Ntk_t *>(pAig)->pManFunc) );
     } catch (std::bad_alloc &ba) {
@@ -345,6 +863,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1AigCleanup
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCheck
   (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_TIMED();
     int32_t result;
 
     try {
@@ -357,6 +876,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCheck
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjIsCi
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -367,20 +887,9 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjIsCi
     return (jboolean)result;
 }
 
-JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjIsComplement
-  (JNIEnv *env, jclass, jlong pObj) {
-    int32_t result;
-
-    try {
-        result = Abc_ObjIsComplement( reinterpret_cast<Abc_Obj_t *>(pObj) );
-    } catch (std::bad_alloc &ba) {
-         out_of_mem_exception(env);
-    }
-    return (jboolean)result;
-}
-
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1AigNodeIsConst
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -393,6 +902,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1AigNodeIsConst
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFanin0
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -405,6 +915,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFanin0
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFanin1
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -417,6 +928,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFanin1
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFaninC0
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -429,6 +941,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFaninC0
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFaninC1
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -441,6 +954,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjFaninC1
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild0
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -453,6 +967,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild0
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild1
   (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -463,156 +978,349 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild1
     return result;
 }
 
+/*
+ * LITERAL HANDLES
+ *
+ * A literal is 2*Id + complement, relative to the network's object vector.
+ */
+static inline jint abc2java_AbcObjToLit( Abc_Obj_t * pObj ) {
+    return Abc_Var2Lit( Abc_ObjId(Abc_ObjRegular(pObj)), Abc_ObjIsComplement(pObj) );
+}
+
+static inline Abc_Obj_t * abc2java_AbcObjFromLit( Abc_Ntk_t * pNtk, jint Lit ) {
+    return Abc_ObjNotCond( Abc_NtkObj(pNtk, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit) );
+}
 
-//////////////////////////////////////
-// FRAIG
-//////////////////////////////////////
+// the literal refers to an object that exists (ids of deleted objects are NULL)
+static inline int abc2java_AbcLitValid( Abc_Ntk_t * pNtk, jint Lit ) {
+    return Lit >= 0 && Abc_Lit2Var(Lit) < Abc_NtkObjNumMax(pNtk) && Abc_NtkObj(pNtk, Abc_Lit2Var(Lit)) != NULL;
+}
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCreate
-  (JNIEnv *env, jclass, jlong fParams) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkObjNumMax
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
 
     try {
-        if (fParams < 0) {
-            result = reinterpret_cast<jlong>(Fraig_ManCreate( NULL ));
-        }
-        else {
-            result = reinterpret_cast<jlong>(Fraig_ManCreate( reinterpret_cast<Fraig_Params_t *>(fParams) ));
-        }
+        result = Abc_NtkObjNumMax( reinterpret_cast<Abc_Ntk_t *>(pAig) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManFree
-  (JNIEnv *env, jclass, jlong fAig) {
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjToLit
+  (JNIEnv *env, jclass, jlong pObj) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
     try {
-        Fraig_ManFree( reinterpret_cast<Fraig_Man_t *>(fAig));
+        result = abc2java_AbcObjToLit( reinterpret_cast<Abc_Obj_t *>(pObj) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
+    return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadConst1
-  (JNIEnv *env, jclass, jlong fAig) {
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkObjFromLit
+  (JNIEnv *env, jclass, jlong pAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
+    if (!abc2java_AbcLitValid(reinterpret_cast<Abc_Ntk_t *>(pAig), lit)) {
+        standard_exception(env);
+        return 0;
+    }
     try {
-        result = reinterpret_cast<jlong>(Fraig_ManReadConst1( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+        result = reinterpret_cast<jlong>(abc2java_AbcObjFromLit( reinterpret_cast<Abc_Ntk_t *>(pAig), lit ));
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadIthVar
-  (JNIEnv *env, jclass, jlong fAig, jint i) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreatePiLit
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Fraig_ManReadIthVar( reinterpret_cast<Fraig_Man_t *>(fAig),
-                                                              reinterpret_cast<int>(i) ));
+        result = abc2java_AbcObjToLit( Abc_NtkCreatePi( reinterpret_cast<Abc_Ntk_t *>(pAig) ) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeAnd
-  (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1AigConst1Lit
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Fraig_NodeAnd( reinterpret_cast<Fraig_Man_t *>(fAig),
-                                                        reinterpret_cast<Fraig_Node_t *>(fObjA),
-                                                        reinterpret_cast<Fraig_Node_t *>(fObjB) ));
+        result = abc2java_AbcObjToLit( Abc_AigConst1( reinterpret_cast<Abc_Ntk_t *>(pAig) ) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeOr
-  (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1AigAndLit
+  (JNIEnv *env, jclass, jlong pAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
 
+    if (!abc2java_AbcLitValid(pNtk, litA) || !abc2java_AbcLitValid(pNtk, litB)) {
+        standard_exception(env);
+        return 0;
+    }
     try {
-        result = reinterpret_cast<jlong>(Fraig_NodeOr( reinterpret_cast<Fraig_Man_t *>(fAig),
-                                                        reinterpret_cast<Fraig_Node_t *>(fObjA),
-                                                        reinterpret_cast<Fraig_Node_t *>(fObjB) ));
+        result = abc2java_AbcObjToLit( Abc_AigAnd( reinterpret_cast<Abc_Aig_t *>(pNtk->pManFunc),
+                                                   abc2java_AbcObjFromLit(pNtk, litA),
+                                                   abc2java_AbcObjFromLit(pNtk, litB) ));
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1Not
-  (JNIEnv *env, jclass, jlong fObj) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1AigOrLit
+  (JNIEnv *env, jclass, jlong pAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
 
+    if (!abc2java_AbcLitValid(pNtk, litA) || !abc2java_AbcLitValid(pNtk, litB)) {
+        standard_exception(env);
+        return 0;
+    }
     try {
-        result = reinterpret_cast<jlong>(Fraig_Not( reinterpret_cast<Fraig_Node_t *>(fObj) ));
+        result = abc2java_AbcObjToLit( Abc_AigOr( reinterpret_cast<Abc_Aig_t *>(pNtk->pManFunc),
+                                                  abc2java_AbcObjFromLit(pNtk, litA),
+                                                  abc2java_AbcObjFromLit(pNtk, litB) ));
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadInputNum
-  (JNIEnv *env, jclass, jlong fAig) {
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild0Lit
+  (JNIEnv *env, jclass, jlong pAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
     jint result = 0;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
 
+    if (!abc2java_AbcLitValid(pNtk, lit) || Abc_ObjFaninNum(Abc_NtkObj(pNtk, Abc_Lit2Var(lit))) < 1) {
+        standard_exception(env);
+        return 0;
+    }
     try {
-        result = reinterpret_cast<jint>(Fraig_ManReadInputNum( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+        result = abc2java_AbcObjToLit( Abc_ObjChild0( Abc_NtkObj(pNtk, Abc_Lit2Var(lit)) ) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1Regular
-  (JNIEnv *env, jclass, jlong fObj) {
-    jlong result = 0;
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjChild1Lit
+  (JNIEnv *env, jclass, jlong pAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
 
+    if (!abc2java_AbcLitValid(pNtk, lit) || Abc_ObjFaninNum(Abc_NtkObj(pNtk, Abc_Lit2Var(lit))) < 2) {
+        standard_exception(env);
+        return 0;
+    }
     try {
-        result = reinterpret_cast<jlong>(Fraig_Regular( reinterpret_cast<Fraig_Node_t *>(fObj) ));
+        result = abc2java_AbcObjToLit( Abc_ObjChild1( Abc_NtkObj(pNtk, Abc_Lit2Var(lit)) ) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
-JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadNum
-  (JNIEnv *env, jclass, jlong fObj) {
-    int32_t result = 0;
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkLitsToObjs
+  (JNIEnv *env, jclass, jlong pAig, jintArray lits, jlongArray objs) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jsize i, n = env->GetArrayLength(lits);
 
-    try {
-        result = Fraig_NodeReadNum( reinterpret_cast<Fraig_Node_t *>(fObj) );
-    } catch (std::bad_alloc &ba) {
-         out_of_mem_exception(env);
+    if (env->GetArrayLength(objs) != n) {
+        standard_exception(env);
+        return;
     }
-    return (jint)result;
-}
+    jint *pLits = env->GetIntArrayElements(lits, NULL);
+    jlong *pObjs = env->GetLongArrayElements(objs, NULL);
+
+    if (pLits == NULL || pObjs == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        for (i = 0; i < n; i++) {
+            if (!abc2java_AbcLitValid(pNtk, pLits[i])) {
+                break;
+            }
+        }
+        if (i < n) {
+            standard_exception(env);
+        } else {
+            for (i = 0; i < n; i++) {
+                pObjs[i] = reinterpret_cast<jlong>(abc2java_AbcObjFromLit( pNtk, pLits[i] ));
+            }
+        }
+    }
+    if (pObjs != NULL) env->ReleaseLongArrayElements(objs, pObjs, 0);
+    if (pLits != NULL) env->ReleaseIntArrayElements(lits, pLits, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1ObjsToLits
+  (JNIEnv *env, jclass, jlongArray objs, jintArray lits) {
+    ABC2JAVA_TRACE_CALL();
+    jsize i, n = env->GetArrayLength(objs);
+
+    if (env->GetArrayLength(lits) != n) {
+        standard_exception(env);
+        return;
+    }
+    jlong *pObjs = env->GetLongArrayElements(objs, NULL);
+    jint *pLits = env->GetIntArrayElements(lits, NULL);
+
+    if (pLits == NULL || pObjs == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        for (i = 0; i < n; i++) {
+            pLits[i] = abc2java_AbcObjToLit( reinterpret_cast<Abc_Obj_t *>(pObjs[i]) );
+        }
+    }
+    if (pLits != NULL) env->ReleaseIntArrayElements(lits, pLits, 0);
+    if (pObjs != NULL) env->ReleaseLongArrayElements(objs, pObjs, JNI_ABORT);
+}
+#endif /* ABC2JAVA_LEAN */
 
-JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeIsVar
-  (JNIEnv *env, jclass, jlong fObj) {
-    int32_t result;
+
+//////////////////////////////////////
+// FRAIG
+//////////////////////////////////////
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCreate
+  (JNIEnv *env, jclass, jlong fParams) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
 
     try {
-        result = Fraig_NodeIsVar( reinterpret_cast<Fraig_Node_t *>(fObj) );
+        if (fParams < 0) {
+            result = reinterpret_cast<jlong>(Fraig_ManCreate( NULL ));
+        }
+        else {
+            result = reinterpret_cast<jlong>(Fraig_ManCreate( reinterpret_cast<Fraig_Params_t *>(fParams) ));
+        }
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
-    return (jboolean)result;
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManFree
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        Fraig_ManFree( reinterpret_cast<Fraig_Man_t *>(fAig));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadConst1
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Fraig_ManReadConst1( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadIthVar
+  (JNIEnv *env, jclass, jlong fAig, jint i) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Fraig_ManReadIthVar( reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                              reinterpret_cast<int>(i) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeAnd
+  (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Fraig_NodeAnd( reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                        reinterpret_cast<Fraig_Node_t *>(fObjA),
+                                                        reinterpret_cast<Fraig_Node_t *>(fObjB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeOr
+  (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(Fraig_NodeOr( reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                        reinterpret_cast<Fraig_Node_t *>(fObjA),
+                                                        reinterpret_cast<Fraig_Node_t *>(fObjB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadInputNum
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = reinterpret_cast<jint>(Fraig_ManReadInputNum( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadNum
+  (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
+    int32_t result = 0;
+
+    try {
+        result = Fraig_NodeReadNum( reinterpret_cast<Fraig_Node_t *>(fObj) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return (jint)result;
 }
 
-JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1IsComplement
+JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeIsVar
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
-        result = Fraig_IsComplement( reinterpret_cast<Fraig_Node_t *>(fObj) );
+        result = Fraig_NodeIsVar( reinterpret_cast<Fraig_Node_t *>(fObj) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
@@ -621,6 +1329,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1IsComplement
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeIsConst
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -633,6 +1342,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeIsConst
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadOne
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -645,6 +1355,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadOne
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadTwo
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -657,6 +1368,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadTwo
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManPrintStats
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     try {
         Fraig_ManPrintStats( reinterpret_cast<Fraig_Man_t *>(fAig));
     } catch (std::bad_alloc &ba) {
@@ -666,6 +1378,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManPrintStats
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodesAreEqual
   (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB, jint nBTLimit, jint nTimeLimit) {
+    ABC2JAVA_TRACE_TIMED();
     int32_t result;
 
     try {
@@ -682,6 +1395,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodesAreEqual
 
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCheckClauseUsingSimInfo
   (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -696,6 +1410,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCheckClauseUsingS
 
 JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCheckClauseUsingSat
   (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB, jint nBTLimit) {
+    ABC2JAVA_TRACE_TIMED();
     int32_t result;
     Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
     int nSatFailsImpOld = fMan->nSatFailsImp;
@@ -719,6 +1434,7 @@ JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCheckClauseUsingSat
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsGetDefault
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -732,6 +1448,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsGetDefault
 
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsGetDefaultFull
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -745,6 +1462,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsGetDefaultFull
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nPatsRand
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nPatsRand = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -754,6 +1472,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nPatsRand
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nPatsDyna
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nPatsDyna = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -763,6 +1482,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nPatsDyna
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nBTLimit
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nBTLimit = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -772,6 +1492,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nBTLimit
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nSeconds
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nSeconds = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -781,6 +1502,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nSeconds
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fFuncRed
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fFuncRed = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -790,6 +1512,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fFuncRed
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fFeedBack
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fFeedBack = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -799,6 +1522,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fFeedBack
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fDist1Pats
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fDist1Pats = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -808,6 +1532,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fDist1Pats
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fDoSparse
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fDoSparse = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -817,6 +1542,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fDoSparse
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fChoicing
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fChoicing = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -826,6 +1552,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fChoicing
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fTryProve
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fTryProve = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -835,6 +1562,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fTryProve
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fVerbose
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fVerbose = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -844,6 +1572,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fVerbose
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fVerboseP
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fVerboseP = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -853,6 +1582,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fVerboseP
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fInternal
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->fInternal = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -862,6 +1592,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1fInternal
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nConfLimit
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nConfLimit = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -871,6 +1602,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nConfLimit
 
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nInspLimit
   (JNIEnv *env, jclass, jlong fParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
     try {
         ( reinterpret_cast<Fraig_Params_t *>(fParams))->nInspLimit = reinterpret_cast<int>(n);
     } catch (std::bad_alloc &ba) {
@@ -878,6 +1610,191 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nInspLimit
     }
 }
 
+/*
+ * LITERAL HANDLES
+ *
+ * A literal is 2*Num + complement; Num indexes the manager's node vector.
+ */
+static inline jint abc2java_FraigNodeToLit( Fraig_Node_t * fObj ) {
+    return Abc_Var2Lit( Fraig_Regular(fObj)->Num, Fraig_IsComplement(fObj) );
+}
+
+static inline Fraig_Node_t * abc2java_FraigNodeFromLit( Fraig_Man_t * fMan, jint Lit ) {
+    return Fraig_NotCond( fMan->vNodes->pArray[Abc_Lit2Var(Lit)], Abc_LitIsCompl(Lit) );
+}
+
+// the literal refers to a node of the manager (Fraig nodes are never deleted)
+static inline int abc2java_FraigLitValid( Fraig_Man_t * fMan, jint Lit ) {
+    return Lit >= 0 && Abc_Lit2Var(Lit) < fMan->vNodes->nSize;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadNodeNum
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = reinterpret_cast<Fraig_Man_t *>(fAig)->vNodes->nSize;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeToLit
+  (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_FraigNodeToLit( reinterpret_cast<Fraig_Node_t *>(fObj) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManNodeFromLit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    if (!abc2java_FraigLitValid(reinterpret_cast<Fraig_Man_t *>(fAig), lit)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_FraigNodeFromLit( reinterpret_cast<Fraig_Man_t *>(fAig), lit ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadConst1Lit
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_ManReadConst1( reinterpret_cast<Fraig_Man_t *>(fAig) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadIthVarLit
+  (JNIEnv *env, jclass, jlong fAig, jint i) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_ManReadIthVar( reinterpret_cast<Fraig_Man_t *>(fAig), i ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeAndLit
+  (JNIEnv *env, jclass, jlong fAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+
+    if (!abc2java_FraigLitValid(fMan, litA) || !abc2java_FraigLitValid(fMan, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_NodeAnd( fMan,
+                                                         abc2java_FraigNodeFromLit(fMan, litA),
+                                                         abc2java_FraigNodeFromLit(fMan, litB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeOrLit
+  (JNIEnv *env, jclass, jlong fAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+
+    if (!abc2java_FraigLitValid(fMan, litA) || !abc2java_FraigLitValid(fMan, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_NodeOr( fMan,
+                                                        abc2java_FraigNodeFromLit(fMan, litA),
+                                                        abc2java_FraigNodeFromLit(fMan, litB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadOneLit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+
+    if (!abc2java_FraigLitValid(fMan, lit) || !Fraig_NodeIsAnd(fMan->vNodes->pArray[Abc_Lit2Var(lit)])) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_NodeReadOne( fMan->vNodes->pArray[Abc_Lit2Var(lit)] ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeReadTwoLit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+
+    if (!abc2java_FraigLitValid(fMan, lit) || !Fraig_NodeIsAnd(fMan->vNodes->pArray[Abc_Lit2Var(lit)])) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_FraigNodeToLit( Fraig_NodeReadTwo( fMan->vNodes->pArray[Abc_Lit2Var(lit)] ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodesAreEqualLit
+  (JNIEnv *env, jclass, jlong fAig, jint litA, jint litB, jint nBTLimit, jint nTimeLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    int32_t result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+
+    if (!abc2java_FraigLitValid(fMan, litA) || !abc2java_FraigLitValid(fMan, litB)) {
+        standard_exception(env);
+        return JNI_FALSE;
+    }
+    try {
+        result = Fraig_NodesAreEqual(   fMan,
+                                        abc2java_FraigNodeFromLit(fMan, litA),
+                                        abc2java_FraigNodeFromLit(fMan, litB),
+                                        nBTLimit,
+                                        nTimeLimit    );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return (jboolean)result;
+}
+
 
 //////////////////////////////////////
 // IVYAIG
@@ -890,6 +1807,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ParamsSet_1nInspLimit
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManStart
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -907,6 +1825,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManStart
  */
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManStop
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     try {
         Ivy_ManStop( reinterpret_cast<Ivy_Man_t *>(fAig));
     } catch (std::bad_alloc &ba) {
@@ -921,6 +1840,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManStop
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManConst1
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -938,6 +1858,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManConst1
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjCreatePi
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -955,6 +1876,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjCreatePi
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1And
   (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -974,6 +1896,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1And
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Or
   (JNIEnv *env, jclass, jlong fAig, jlong fObjA, jlong fObjB) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -988,21 +1911,24 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Or
 
 /*
  * Class:     com_berkeley_abc_Abc
- * Method:    Ivy_Not
- * Signature: (J)J
+ * Method:    Ivy_ObjCreatePo
+ * Signature: (JJ)J
  */
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Not
-  (JNIEnv *env, jclass, jlong fObj) {
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjCreatePo
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Ivy_Not( reinterpret_cast<Ivy_Obj_t *>(fObj) ));
+        result = reinterpret_cast<jlong>(Ivy_ObjCreatePo( reinterpret_cast<Ivy_Man_t *>(fAig),
+                                                          reinterpret_cast<Ivy_Obj_t *>(fObj) ));
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
     return result;
 }
 
+
 /*
  * Class:     com_berkeley_abc_Abc
  * Method:    Ivy_ManPiNum
@@ -1010,6 +1936,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Not
  */
 JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManPiNum
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     jint result = 0;
 
     try {
@@ -1022,36 +1949,20 @@ JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManPiNum
 
 /*
  * Class:     com_berkeley_abc_Abc
- * Method:    Ivy_Regular
- * Signature: (J)J
+ * Method:    Ivy_ObjId
+ * Signature: (J)I
  */
-JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Regular
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjId
   (JNIEnv *env, jclass, jlong fObj) {
-    jlong result = 0;
+    ABC2JAVA_TRACE_CALL();
+    int32_t result = 0;
 
     try {
-        result = reinterpret_cast<jlong>(Ivy_Regular( reinterpret_cast<Ivy_Obj_t *>(fObj) ));
+        result = Ivy_ObjId( reinterpret_cast<Ivy_Obj_t *>(fObj) );
     } catch (std::bad_alloc &ba) {
          out_of_mem_exception(env);
     }
-    return result;
-}
-
-/*
- * Class:     com_berkeley_abc_Abc
- * Method:    Ivy_ObjId
- * Signature: (J)I
- */
-JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjId
-  (JNIEnv *env, jclass, jlong fObj) {
-    int32_t result = 0;
-
-    try {
-        result = Ivy_ObjId( reinterpret_cast<Ivy_Obj_t *>(fObj) );
-    } catch (std::bad_alloc &ba) {
-         out_of_mem_exception(env);
-    }
-    return (jint)result;
+    return (jint)result;
 }
 
 /*
@@ -1061,6 +1972,7 @@ JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjId
  */
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjIsPi
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -1071,23 +1983,6 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjIsPi
     return (jboolean)result;
 }
 
-/*
- * Class:     com_berkeley_abc_Abc
- * Method:    Ivy_IsComplement
- * Signature: (J)Z
- */
-JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1IsComplement
-  (JNIEnv *env, jclass, jlong fObj) {
-    int32_t result;
-
-    try {
-        result = Ivy_IsComplement( reinterpret_cast<Ivy_Obj_t *>(fObj) );
-    } catch (std::bad_alloc &ba) {
-         out_of_mem_exception(env);
-    }
-    return (jboolean)result;
-}
-
 /*
  * Class:     com_berkeley_abc_Abc
  * Method:    Ivy_ObjIsConst1
@@ -1095,6 +1990,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1IsComplement
  */
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjIsConst1
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -1112,6 +2008,7 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjIsConst1
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild0
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -1129,6 +2026,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild0
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild1
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -1146,6 +2044,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild1
  */
 JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManPrintStats
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     try {
         Ivy_ManPrintStats( reinterpret_cast<Ivy_Man_t *>(fAig) );
     } catch (std::bad_alloc &ba) {
@@ -1161,6 +2060,7 @@ JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManPrintStats
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1FraigParamsDefault
   (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -1179,6 +2079,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1FraigParamsDefault
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1FraigPerform
   (JNIEnv *env, jclass, jlong fAig, jlong fParams) {
+    ABC2JAVA_TRACE_TIMED();
     jlong result = 0;
 
     try {
@@ -1197,6 +2098,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1FraigPerform
  */
 JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjEquiv
   (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
     jlong result = 0;
 
     try {
@@ -1214,6 +2116,7 @@ JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjEquiv
  */
 JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManCheck
   (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
     int32_t result;
 
     try {
@@ -1224,6 +2127,6422 @@ JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManCheck
     return (jboolean)result;
 }
 
+/*
+ * LITERAL HANDLES
+ *
+ * A literal is 2*Id + complement, relative to the manager's object vector.
+ */
+static inline jint abc2java_IvyObjToLit( Ivy_Obj_t * fObj ) {
+    return Abc_Var2Lit( Ivy_ObjId(Ivy_Regular(fObj)), Ivy_IsComplement(fObj) );
+}
+
+static inline Ivy_Obj_t * abc2java_IvyObjFromLit( Ivy_Man_t * fMan, jint Lit ) {
+    return Ivy_NotCond( Ivy_ManObj(fMan, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit) );
+}
+
+// the literal refers to an object that exists (ids of deleted objects are NULL)
+static inline int abc2java_IvyLitValid( Ivy_Man_t * fMan, jint Lit ) {
+    return Lit >= 0 && Abc_Lit2Var(Lit) <= Ivy_ManObjIdMax(fMan) && Ivy_ManObj(fMan, Abc_Lit2Var(Lit)) != NULL;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManObjIdMax
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = Ivy_ManObjIdMax( reinterpret_cast<Ivy_Man_t *>(fAig) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjToLit
+  (JNIEnv *env, jclass, jlong fObj) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_IvyObjToLit( reinterpret_cast<Ivy_Obj_t *>(fObj) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManObjFromLit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    if (!abc2java_IvyLitValid(reinterpret_cast<Ivy_Man_t *>(fAig), lit)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_IvyObjFromLit( reinterpret_cast<Ivy_Man_t *>(fAig), lit ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManConst1Lit
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_IvyObjToLit( Ivy_ManConst1( reinterpret_cast<Ivy_Man_t *>(fAig) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjCreatePiLit
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = abc2java_IvyObjToLit( Ivy_ObjCreatePi( reinterpret_cast<Ivy_Man_t *>(fAig) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1AndLit
+  (JNIEnv *env, jclass, jlong fAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+
+    if (!abc2java_IvyLitValid(fMan, litA) || !abc2java_IvyLitValid(fMan, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_IvyObjToLit( Ivy_And( fMan,
+                                                abc2java_IvyObjFromLit(fMan, litA),
+                                                abc2java_IvyObjFromLit(fMan, litB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1OrLit
+  (JNIEnv *env, jclass, jlong fAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+
+    if (!abc2java_IvyLitValid(fMan, litA) || !abc2java_IvyLitValid(fMan, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_IvyObjToLit( Ivy_Or( fMan,
+                                               abc2java_IvyObjFromLit(fMan, litA),
+                                               abc2java_IvyObjFromLit(fMan, litB) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild0Lit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+
+    if (!abc2java_IvyLitValid(fMan, lit) || Ivy_ObjFanin0(Ivy_ManObj(fMan, Abc_Lit2Var(lit))) == NULL) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_IvyObjToLit( Ivy_ObjChild0( Ivy_ManObj(fMan, Abc_Lit2Var(lit)) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ObjChild1Lit
+  (JNIEnv *env, jclass, jlong fAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+
+    if (!abc2java_IvyLitValid(fMan, lit) || Ivy_ObjFanin1(Ivy_ManObj(fMan, Abc_Lit2Var(lit))) == NULL) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = abc2java_IvyObjToLit( Ivy_ObjChild1( Ivy_ManObj(fMan, Abc_Lit2Var(lit)) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+
+#ifndef ABC2JAVA_LEAN
+//////////////////////////////////////
+// CONES AND PARTITIONS
+//////////////////////////////////////
+
+/*
+ * Copies the combinational cone of the given POs into a new strashed network.
+ * Only the CIs in the support are created, unless fUseAllCis is set, in which
+ * case all CIs are created in their original order. Latch outputs in the
+ * support become PIs of the cone.
+ */
+static Abc_Ntk_t * abc2java_NtkCreateConeOutputs( Abc_Ntk_t * pNtk, const jint * pPos, int nPos, int fUseAllCis )
+{
+    Abc_Ntk_t * pNtkNew;
+    Abc_Obj_t * pObj, * pPo;
+    Vec_Ptr_t * vRoots, * vNodes;
+    int i;
+
+    assert( Abc_NtkIsStrash(pNtk) );
+    vRoots = Vec_PtrAlloc( nPos );
+    for ( i = 0; i < nPos; i++ )
+        Vec_PtrPush( vRoots, Abc_NtkPo(pNtk, pPos[i]) );
+    // collect the AND nodes in the TFI of the POs (also marks the CIs in the TFI)
+    vNodes = Abc_NtkDfsNodes( pNtk, (Abc_Obj_t **)Vec_PtrArray(vRoots), Vec_PtrSize(vRoots) );
+
+    pNtkNew = Abc_NtkAlloc( ABC_NTK_STRASH, ABC_FUNC_AIG, 1 );
+    pNtkNew->pName = Extra_UtilStrsav( pNtk->pName );
+    Abc_AigConst1(pNtk)->pCopy = Abc_AigConst1(pNtkNew);
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        if ( fUseAllCis || Abc_NodeIsTravIdCurrent(pObj) )
+        {
+            pObj->pCopy = Abc_NtkCreatePi( pNtkNew );
+            Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(pObj), NULL );
+        }
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        if ( Abc_AigNodeIsAnd(pObj) )
+            pObj->pCopy = Abc_AigAnd( (Abc_Aig_t *)pNtkNew->pManFunc, Abc_ObjChild0Copy(pObj), Abc_ObjChild1Copy(pObj) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vRoots, pObj, i )
+    {
+        pPo = Abc_NtkCreatePo( pNtkNew );
+        Abc_ObjAddFanin( pPo, Abc_ObjChild0Copy(pObj) );
+        Abc_ObjAssignName( pPo, Abc_ObjName(pObj), NULL );
+    }
+    Vec_PtrFree( vNodes );
+    Vec_PtrFree( vRoots );
+    return pNtkNew;
+}
+
+/*
+ * Supports of all POs as sorted CI indices, in one topological pass: each
+ * AND node merges the supports of its fanins, which are freed once their
+ * last AND or PO fanout has used them.
+ */
+static Vec_Int_t ** abc2java_NtkPoSupports( Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t ** pSupps, ** pObjSupps, * vSupp0, * vSupp1, * vSupp;
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj, * pFanin;
+    int * pRefs;
+    int i, k, a, b;
+
+    pSupps    = ABC_ALLOC( Vec_Int_t *, Abc_NtkPoNum(pNtk) + 1 );
+    pObjSupps = ABC_CALLOC( Vec_Int_t *, Abc_NtkObjNumMax(pNtk) );
+    pRefs     = ABC_CALLOC( int, Abc_NtkObjNumMax(pNtk) );
+    vNodes    = Abc_NtkDfs( pNtk, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        pRefs[Abc_ObjFaninId0(pObj)]++;
+        pRefs[Abc_ObjFaninId1(pObj)]++;
+    }
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        pRefs[Abc_ObjFaninId0(pObj)]++;
+    pObjSupps[Abc_ObjId(Abc_AigConst1(pNtk))] = Vec_IntAlloc( 0 );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+    {
+        pObjSupps[Abc_ObjId(pObj)] = Vec_IntAlloc( 1 );
+        Vec_IntPush( pObjSupps[Abc_ObjId(pObj)], i );
+    }
+
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        vSupp0 = pObjSupps[Abc_ObjFaninId0(pObj)];
+        vSupp1 = pObjSupps[Abc_ObjFaninId1(pObj)];
+        vSupp  = Vec_IntAlloc( Vec_IntSize(vSupp0) + Vec_IntSize(vSupp1) );
+        for ( a = b = 0; a < Vec_IntSize(vSupp0) && b < Vec_IntSize(vSupp1); )
+        {
+            if ( Vec_IntEntry(vSupp0, a) < Vec_IntEntry(vSupp1, b) )
+                Vec_IntPush( vSupp, Vec_IntEntry(vSupp0, a++) );
+            else if ( Vec_IntEntry(vSupp0, a) > Vec_IntEntry(vSupp1, b) )
+                Vec_IntPush( vSupp, Vec_IntEntry(vSupp1, b++) );
+            else
+            {
+                Vec_IntPush( vSupp, Vec_IntEntry(vSupp0, a++) );
+                b++;
+            }
+        }
+        for ( ; a < Vec_IntSize(vSupp0); a++ )
+            Vec_IntPush( vSupp, Vec_IntEntry(vSupp0, a) );
+        for ( ; b < Vec_IntSize(vSupp1); b++ )
+            Vec_IntPush( vSupp, Vec_IntEntry(vSupp1, b) );
+        pObjSupps[Abc_ObjId(pObj)] = vSupp;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            if ( --pRefs[Abc_ObjId(pFanin)] == 0 )
+            {
+                Vec_IntFree( pObjSupps[Abc_ObjId(pFanin)] );
+                pObjSupps[Abc_ObjId(pFanin)] = NULL;
+            }
+    }
+    Abc_NtkForEachPo( pNtk, pObj, i )
+    {
+        pSupps[i] = Vec_IntDup( pObjSupps[Abc_ObjFaninId0(pObj)] );
+        if ( --pRefs[Abc_ObjFaninId0(pObj)] == 0 )
+        {
+            Vec_IntFree( pObjSupps[Abc_ObjFaninId0(pObj)] );
+            pObjSupps[Abc_ObjFaninId0(pObj)] = NULL;
+        }
+    }
+
+    for ( i = 0; i < Abc_NtkObjNumMax(pNtk); i++ )
+        if ( pObjSupps[i] )
+            Vec_IntFree( pObjSupps[i] );
+    Vec_PtrFree( vNodes );
+    ABC_FREE( pObjSupps );
+    ABC_FREE( pRefs );
+    return pSupps;
+}
+
+/*
+ * Assigns each PO to one of nParts clusters holding at most ceil(nPos/nParts)
+ * outputs. POs are placed largest support first, into the open cluster whose
+ * accumulated support they overlap most (ties go to the smaller cluster).
+ */
+static void abc2java_NtkPartitionOutputs( Abc_Ntk_t * pNtk, int nParts, jint * pPart )
+{
+    Vec_Int_t ** pSupps;
+    unsigned char * pMarks;
+    int * pOrder, * pCounts;
+    int nPos = Abc_NtkPoNum(pNtk), nCis = Abc_NtkCiNum(pNtk);
+    int nCap = (nPos + nParts - 1) / nParts;
+    int i, k, j, c, iCi, iBest, nOver, nOverBest;
+
+    pSupps = abc2java_NtkPoSupports( pNtk );
+    pOrder = ABC_ALLOC( int, nPos );
+    for ( i = 0; i < nPos; i++ )
+        pOrder[i] = i;
+    std::stable_sort( pOrder, pOrder + nPos, [pSupps](int a, int b) {
+        return Vec_IntSize(pSupps[a]) > Vec_IntSize(pSupps[b]);
+    } );
+
+    pMarks  = ABC_CALLOC( unsigned char, (size_t)nParts * nCis );
+    pCounts = ABC_CALLOC( int, nParts );
+    for ( j = 0; j < nPos; j++ )
+    {
+        i = pOrder[j];
+        iBest = -1; nOverBest = -1;
+        for ( k = 0; k < nParts; k++ )
+        {
+            if ( pCounts[k] == nCap )
+                continue;
+            nOver = 0;
+            Vec_IntForEachEntry( pSupps[i], iCi, c )
+                nOver += pMarks[(size_t)k * nCis + iCi];
+            if ( nOver > nOverBest || (nOver == nOverBest && pCounts[k] < pCounts[iBest]) )
+                iBest = k, nOverBest = nOver;
+        }
+        assert( iBest >= 0 );
+        pPart[i] = iBest;
+        pCounts[iBest]++;
+        Vec_IntForEachEntry( pSupps[i], iCi, c )
+            pMarks[(size_t)iBest * nCis + iCi] = 1;
+    }
+
+    for ( i = 0; i < nPos; i++ )
+        Vec_IntFree( pSupps[i] );
+    ABC_FREE( pSupps );
+    ABC_FREE( pOrder );
+    ABC_FREE( pMarks );
+    ABC_FREE( pCounts );
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCreateConeOutputs
+  (JNIEnv *env, jclass, jlong pAig, jintArray pos, jboolean fUseAllCis) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+    jsize i, nPos = env->GetArrayLength(pos);
+    jint *pPos = env->GetIntArrayElements(pos, NULL);
+
+    if (pPos == NULL) {
+        out_of_mem_exception(env);
+        return result;
+    }
+    for (i = 0; i < nPos; i++) {
+        if (pPos[i] < 0 || pPos[i] >= Abc_NtkPoNum(pNtk)) {
+            env->ReleaseIntArrayElements(pos, pPos, JNI_ABORT);
+            standard_exception(env);
+            return result;
+        }
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_NtkCreateConeOutputs( pNtk, pPos, nPos, fUseAllCis ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseIntArrayElements(pos, pPos, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPartitionOutputs
+  (JNIEnv *env, jclass, jlong pAig, jint nParts, jintArray poToPart, jboolean fUseAllCis) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlongArray result = NULL;
+    jlong *pNtks = NULL;
+    jint *pPart = NULL, *pPos = NULL;
+    int i, k, nPos = Abc_NtkPoNum(pNtk), nPosPart;
+
+    if (nParts < 1 || env->GetArrayLength(poToPart) < nPos) {
+        standard_exception(env);
+        return NULL;
+    }
+    try {
+        pPart = ABC_ALLOC( jint, nPos + 1 );
+        pPos  = ABC_ALLOC( jint, nPos + 1 );
+        pNtks = ABC_ALLOC( jlong, nParts );
+        abc2java_NtkPartitionOutputs( pNtk, nParts, pPart );
+        for ( k = 0; k < nParts; k++ )
+        {
+            for ( nPosPart = i = 0; i < nPos; i++ )
+                if ( pPart[i] == k )
+                    pPos[nPosPart++] = i;
+            pNtks[k] = reinterpret_cast<jlong>(abc2java_NtkCreateConeOutputs( pNtk, pPos, nPosPart, fUseAllCis ));
+        }
+        result = env->NewLongArray(nParts);
+        if (result == NULL) {
+            out_of_mem_exception(env);
+        } else {
+            env->SetLongArrayRegion(result, 0, nParts, pNtks);
+            env->SetIntArrayRegion(poToPart, 0, nPos, pPart);
+        }
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    ABC_FREE( pPart );
+    ABC_FREE( pPos );
+    ABC_FREE( pNtks );
+    return result;
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// DESIGN DIFF
+//////////////////////////////////////
+
+#ifndef ABC2JAVA_LEAN
+/*
+ * Matches the AND nodes of pNew against the structural hash table of pOld,
+ * from the CIs (paired by index) upward, and collects the POs of pNew whose
+ * driver has no identical counterpart at the same PO of pOld.
+ */
+static Vec_Int_t * abc2java_NtkDiffOutputs( Abc_Ntk_t * pOld, Abc_Ntk_t * pNew )
+{
+    Vec_Int_t * vDiff;
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj;
+    int i;
+
+    assert( Abc_NtkIsStrash(pOld) && Abc_NtkIsStrash(pNew) );
+    Abc_NtkCleanCopy( pNew );
+    Abc_AigConst1(pNew)->pCopy = Abc_AigConst1(pOld);
+    Abc_NtkForEachCi( pNew, pObj, i )
+        pObj->pCopy = i < Abc_NtkCiNum(pOld) ? Abc_NtkCi(pOld, i) : NULL;
+    vNodes = Abc_AigDfs( pNew, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        if ( Abc_ObjFanin0(pObj)->pCopy == NULL || Abc_ObjFanin1(pObj)->pCopy == NULL )
+            continue;
+        pObj->pCopy = Abc_AigAndLookup( (Abc_Aig_t *)pOld->pManFunc, Abc_ObjChild0Copy(pObj), Abc_ObjChild1Copy(pObj) );
+    }
+    Vec_PtrFree( vNodes );
+
+    vDiff = Vec_IntAlloc( 16 );
+    Abc_NtkForEachPo( pNew, pObj, i )
+        if ( i >= Abc_NtkPoNum(pOld) || Abc_ObjFanin0(pObj)->pCopy == NULL ||
+             Abc_ObjChild0Copy(pObj) != Abc_ObjChild0(Abc_NtkPo(pOld, i)) )
+            Vec_IntPush( vDiff, i );
+    return vDiff;
+}
+#endif
+
+static Ivy_Obj_t * abc2java_IvyMatch_rec( Ivy_Man_t * pOld, Ivy_Obj_t * pObj, Ivy_Obj_t ** pMap, char * pVisited )
+{
+    Ivy_Obj_t * p0, * p1;
+
+    assert( !Ivy_IsComplement(pObj) );
+    if ( pVisited[pObj->Id] )
+        return pMap[pObj->Id];
+    pVisited[pObj->Id] = 1;
+    if ( Ivy_ObjIsBuf(pObj) )
+    {
+        p0 = abc2java_IvyMatch_rec( pOld, Ivy_ObjFanin0(pObj), pMap, pVisited );
+        pMap[pObj->Id] = p0 ? Ivy_NotCond( p0, Ivy_ObjFaninC0(pObj) ) : NULL;
+    }
+    else if ( Ivy_ObjIsAnd(pObj) || Ivy_ObjIsExor(pObj) )
+    {
+        p0 = abc2java_IvyMatch_rec( pOld, Ivy_ObjFanin0(pObj), pMap, pVisited );
+        p1 = abc2java_IvyMatch_rec( pOld, Ivy_ObjFanin1(pObj), pMap, pVisited );
+        if ( p0 && p1 )
+            pMap[pObj->Id] = Ivy_TableLookup( pOld, Ivy_ObjCreateGhost( pOld,
+                                 Ivy_NotCond( p0, Ivy_ObjFaninC0(pObj) ),
+                                 Ivy_NotCond( p1, Ivy_ObjFaninC1(pObj) ),
+                                 Ivy_ObjIsAnd(pObj) ? IVY_AND : IVY_EXOR, IVY_INIT_NONE ) );
+    }
+    return pMap[pObj->Id];
+}
+
+/*
+ * Same as above for two Ivy managers, comparing pairs of root nodes
+ * (PIs are paired by index).
+ */
+static Vec_Int_t * abc2java_IvyDiffRoots( Ivy_Man_t * pOld, Ivy_Man_t * pNew, const jlong * pOldRoots, const jlong * pNewRoots, int nRoots )
+{
+    Vec_Int_t * vDiff;
+    Ivy_Obj_t ** pMap, * pObj, * pMatch;
+    char * pVisited;
+    int i, nObjs = Ivy_ManObjIdMax(pNew) + 1;
+
+    pMap     = ABC_CALLOC( Ivy_Obj_t *, nObjs );
+    pVisited = ABC_CALLOC( char, nObjs );
+    pObj = Ivy_ManConst1(pNew);
+    pMap[pObj->Id] = Ivy_ManConst1(pOld);
+    pVisited[pObj->Id] = 1;
+    Ivy_ManForEachPi( pNew, pObj, i )
+    {
+        pMap[pObj->Id] = i < Ivy_ManPiNum(pOld) ? Ivy_ManPi(pOld, i) : NULL;
+        pVisited[pObj->Id] = 1;
+    }
+
+    vDiff = Vec_IntAlloc( 16 );
+    for ( i = 0; i < nRoots; i++ )
+    {
+        pObj = reinterpret_cast<Ivy_Obj_t *>(pNewRoots[i]);
+        pMatch = abc2java_IvyMatch_rec( pOld, Ivy_Regular(pObj), pMap, pVisited );
+        if ( pMatch == NULL || Ivy_NotCond(pMatch, Ivy_IsComplement(pObj)) != reinterpret_cast<Ivy_Obj_t *>(pOldRoots[i]) )
+            Vec_IntPush( vDiff, i );
+    }
+    ABC_FREE( pMap );
+    ABC_FREE( pVisited );
+    return vDiff;
+}
+
+#ifndef ABC2JAVA_LEAN
+/*
+ * Adds the PO functions of a strashed network to a Fraig manager, pairing
+ * the CIs with the manager's inputs by index. Nodes already known to the
+ * manager, structurally or as proven equivalences, are reused as is.
+ */
+static void abc2java_NtkAddToFraig( Fraig_Man_t * fMan, Abc_Ntk_t * pNtk, jlong * pOuts )
+{
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj;
+    int i;
+
+    assert( Abc_NtkIsStrash(pNtk) );
+    Abc_AigConst1(pNtk)->pCopy = (Abc_Obj_t *)Fraig_ManReadConst1( fMan );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        pObj->pCopy = (Abc_Obj_t *)Fraig_ManReadIthVar( fMan, i );
+    vNodes = Abc_AigDfs( pNtk, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        pObj->pCopy = (Abc_Obj_t *)Fraig_NodeAnd( fMan, (Fraig_Node_t *)Abc_ObjChild0Copy(pObj),
+                                                        (Fraig_Node_t *)Abc_ObjChild1Copy(pObj) );
+    Vec_PtrFree( vNodes );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        pOuts[i] = reinterpret_cast<jlong>(Abc_ObjChild0Copy(pObj));
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkDiffOutputs
+  (JNIEnv *env, jclass, jlong pOld, jlong pNew) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+
+    try {
+        result = convertToIntArray(env, abc2java_NtkDiffOutputs( reinterpret_cast<Abc_Ntk_t *>(pOld),
+                                                                 reinterpret_cast<Abc_Ntk_t *>(pNew) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManDiffRoots
+  (JNIEnv *env, jclass, jlong fOld, jlong fNew, jlongArray oldRoots, jlongArray newRoots) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    jsize nRoots = env->GetArrayLength(newRoots);
+    jlong *pOldRoots, *pNewRoots;
+
+    if (env->GetArrayLength(oldRoots) != nRoots) {
+        standard_exception(env);
+        return NULL;
+    }
+    pOldRoots = env->GetLongArrayElements(oldRoots, NULL);
+    pNewRoots = env->GetLongArrayElements(newRoots, NULL);
+    if (pOldRoots == NULL || pNewRoots == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        try {
+            result = convertToIntArray(env, abc2java_IvyDiffRoots( reinterpret_cast<Ivy_Man_t *>(fOld),
+                                                                   reinterpret_cast<Ivy_Man_t *>(fNew),
+                                                                   pOldRoots, pNewRoots, nRoots ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pOldRoots != NULL) env->ReleaseLongArrayElements(oldRoots, pOldRoots, JNI_ABORT);
+    if (pNewRoots != NULL) env->ReleaseLongArrayElements(newRoots, pNewRoots, JNI_ABORT);
+    return result;
+}
+
+#ifndef ABC2JAVA_LEAN
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManAddNtk
+  (JNIEnv *env, jclass, jlong fAig, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlongArray result = NULL;
+    jlong *pOuts = NULL;
+    int nPos = Abc_NtkPoNum(pNtk);
+
+    try {
+        pOuts = ABC_ALLOC( jlong, nPos + 1 );
+        abc2java_NtkAddToFraig( reinterpret_cast<Fraig_Man_t *>(fAig), pNtk, pOuts );
+        result = env->NewLongArray(nPos);
+        if (result == NULL) {
+            out_of_mem_exception(env);
+        } else {
+            env->SetLongArrayRegion(result, 0, nPos, pOuts);
+        }
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    ABC_FREE( pOuts );
+    return result;
+}
+#endif
+
+
+//////////////////////////////////////
+// CNF
+//////////////////////////////////////
+
+/*
+ * DIMACS literal of an AIG literal in the CNF (0 if the node has no variable).
+ */
+static inline jint abc2java_CnfDimacsLit( Cnf_Dat_t * pCnf, Aig_Obj_t * pObj ) {
+    int iVar = pCnf->pVarNums[Aig_ObjId(Aig_Regular(pObj))];
+    if ( iVar < 0 )
+        return 0;
+    return Aig_IsComplement(pObj) ? -(iVar + 1) : iVar + 1;
+}
+
+/*
+ * The mapped encoding runs in ABC's global CNF manager (Cnf_ManRead), so
+ * calls from different Java threads are serialized. ABC engines that
+ * derive CNF on their own do not take this lock.
+ */
+static pthread_mutex_t abc2java_CnfMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static inline Cnf_Dat_t * abc2java_CnfDerive( Aig_Man_t * pMan, int fMapped ) {
+    Cnf_Dat_t * pCnf;
+    if ( !fMapped )
+        return Cnf_DeriveSimple( pMan, Aig_ManCoNum(pMan) );
+    pthread_mutex_lock( &abc2java_CnfMutex );
+    pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    pthread_mutex_unlock( &abc2java_CnfMutex );
+    return pCnf;
+}
+
+#ifndef ABC2JAVA_LEAN
+/*
+ * Derives the CNF of all COs of a strashed network. pNodeLits (indexed by
+ * object Id) receives the DIMACS literal of each CI, AND node and CO.
+ */
+static Cnf_Dat_t * abc2java_NtkDeriveCnf( Abc_Ntk_t * pNtk, int fMapped, jint * pNodeLits )
+{
+    Aig_Man_t * pMan;
+    Cnf_Dat_t * pCnf;
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj;
+    int i;
+
+    assert( Abc_NtkIsStrash(pNtk) );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    pCnf = abc2java_CnfDerive( pMan, fMapped );
+    memset( pNodeLits, 0, sizeof(jint) * Abc_NtkObjNumMax(pNtk) );
+    pNodeLits[Abc_ObjId(Abc_AigConst1(pNtk))] = abc2java_CnfDimacsLit( pCnf, Aig_ManConst1(pMan) );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        pNodeLits[Abc_ObjId(pObj)] = abc2java_CnfDimacsLit( pCnf, Aig_ManCi(pMan, i) );
+    // only the nodes reachable from the COs have a live copy in the AIG
+    vNodes = Abc_AigDfs( pNtk, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        pNodeLits[Abc_ObjId(pObj)] = abc2java_CnfDimacsLit( pCnf, (Aig_Obj_t *)pObj->pCopy );
+    Vec_PtrFree( vNodes );
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        pNodeLits[Abc_ObjId(pObj)] = abc2java_CnfDimacsLit( pCnf, Aig_ManCo(pMan, i) );
+    pCnf->pMan = NULL;
+    Aig_ManStop( pMan );
+    return pCnf;
+}
+#endif
+
+static Aig_Obj_t * abc2java_IvyToAig_rec( Aig_Man_t * pMan, Ivy_Obj_t * pObj, Aig_Obj_t ** pCopy )
+{
+    Aig_Obj_t * p0, * p1;
+
+    assert( !Ivy_IsComplement(pObj) );
+    if ( pCopy[pObj->Id] )
+        return pCopy[pObj->Id];
+    p0 = Aig_NotCond( abc2java_IvyToAig_rec( pMan, Ivy_ObjFanin0(pObj), pCopy ), Ivy_ObjFaninC0(pObj) );
+    if ( Ivy_ObjIsBuf(pObj) )
+        return pCopy[pObj->Id] = p0;
+    p1 = Aig_NotCond( abc2java_IvyToAig_rec( pMan, Ivy_ObjFanin1(pObj), pCopy ), Ivy_ObjFaninC1(pObj) );
+    return pCopy[pObj->Id] = Ivy_ObjIsExor(pObj) ? Aig_Exor( pMan, p0, p1 ) : Aig_And( pMan, p0, p1 );
+}
+
+/*
+ * Derives the CNF of the cones of the given Ivy roots, with all PIs as CIs
+ * and one CO per root. pNodeLits (indexed by object Id) receives the DIMACS
+ * literal of each PI and AND node, pRootLits the literal of each root's CO.
+ */
+static Cnf_Dat_t * abc2java_IvyDeriveCnf( Ivy_Man_t * fMan, const jlong * pRoots, int nRoots, int fMapped, jint * pNodeLits, jint * pRootLits )
+{
+    Aig_Man_t * pMan;
+    Cnf_Dat_t * pCnf;
+    Aig_Obj_t ** pCopy;
+    Ivy_Obj_t * pObj;
+    int i, nObjs = Ivy_ManObjIdMax(fMan) + 1;
+
+    pMan  = Aig_ManStart( Ivy_ManNodeNum(fMan) + 100 );
+    pCopy = ABC_CALLOC( Aig_Obj_t *, nObjs );
+    pCopy[Ivy_ManConst1(fMan)->Id] = Aig_ManConst1(pMan);
+    Ivy_ManForEachPi( fMan, pObj, i )
+        pCopy[pObj->Id] = Aig_ObjCreateCi( pMan );
+    for ( i = 0; i < nRoots; i++ )
+    {
+        pObj = reinterpret_cast<Ivy_Obj_t *>(pRoots[i]);
+        Aig_ObjCreateCo( pMan, Aig_NotCond( abc2java_IvyToAig_rec( pMan, Ivy_Regular(pObj), pCopy ), Ivy_IsComplement(pObj) ) );
+    }
+    pCnf = abc2java_CnfDerive( pMan, fMapped );
+    for ( i = 0; i < nObjs; i++ )
+        pNodeLits[i] = pCopy[i] ? abc2java_CnfDimacsLit( pCnf, pCopy[i] ) : 0;
+    for ( i = 0; i < nRoots; i++ )
+        pRootLits[i] = abc2java_CnfDimacsLit( pCnf, Aig_ManCo(pMan, i) );
+    pCnf->pMan = NULL;
+    Aig_ManStop( pMan );
+    ABC_FREE( pCopy );
+    return pCnf;
+}
+
+#ifndef ABC2JAVA_LEAN
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkDeriveCnf
+  (JNIEnv *env, jclass, jlong pAig, jboolean fMapped, jintArray nodeLits) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+    jint *pNodeLits;
+
+    if (env->GetArrayLength(nodeLits) < Abc_NtkObjNumMax(pNtk)) {
+        standard_exception(env);
+        return 0;
+    }
+    pNodeLits = env->GetIntArrayElements(nodeLits, NULL);
+    if (pNodeLits == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_NtkDeriveCnf( pNtk, fMapped, pNodeLits ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseIntArrayElements(nodeLits, pNodeLits, 0);
+    return result;
+}
+#endif
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManDeriveCnf
+  (JNIEnv *env, jclass, jlong fAig, jlongArray roots, jboolean fMapped, jintArray nodeLits, jintArray rootLits) {
+    ABC2JAVA_TRACE_TIMED();
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+    jlong result = 0;
+    jsize nRoots = env->GetArrayLength(roots);
+    jlong *pRoots;
+    jint *pNodeLits, *pRootLits;
+
+    if (env->GetArrayLength(nodeLits) <= Ivy_ManObjIdMax(fMan) || env->GetArrayLength(rootLits) < nRoots) {
+        standard_exception(env);
+        return 0;
+    }
+    pRoots = env->GetLongArrayElements(roots, NULL);
+    pNodeLits = env->GetIntArrayElements(nodeLits, NULL);
+    pRootLits = env->GetIntArrayElements(rootLits, NULL);
+    if (pRoots == NULL || pNodeLits == NULL || pRootLits == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        try {
+            result = reinterpret_cast<jlong>(abc2java_IvyDeriveCnf( fMan, pRoots, nRoots, fMapped, pNodeLits, pRootLits ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pRootLits != NULL) env->ReleaseIntArrayElements(rootLits, pRootLits, 0);
+    if (pNodeLits != NULL) env->ReleaseIntArrayElements(nodeLits, pNodeLits, 0);
+    if (pRoots != NULL) env->ReleaseLongArrayElements(roots, pRoots, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Cnf_1DataNumVars
+  (JNIEnv *env, jclass, jlong pCnf) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<Cnf_Dat_t *>(pCnf)->nVars;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Cnf_1DataNumClauses
+  (JNIEnv *env, jclass, jlong pCnf) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<Cnf_Dat_t *>(pCnf)->nClauses;
+}
+
+/*
+ * Size in bytes of the clause buffer: every literal plus a 0 per clause.
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Cnf_1DataBufferSize
+  (JNIEnv *env, jclass, jlong pCnf) {
+    ABC2JAVA_TRACE_CALL();
+    Cnf_Dat_t *p = reinterpret_cast<Cnf_Dat_t *>(pCnf);
+    return (jlong)sizeof(jint) * ((jlong)p->nLiterals + p->nClauses);
+}
+
+/*
+ * Writes the clauses as DIMACS ints (native byte order), each clause
+ * terminated by 0. Returns the number of ints written, or -1 if the
+ * buffer is not a direct buffer or is too small.
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Cnf_1DataWriteClauses
+  (JNIEnv *env, jclass, jlong pCnf, jobject buf) {
+    ABC2JAVA_TRACE_CALL();
+    Cnf_Dat_t *p = reinterpret_cast<Cnf_Dat_t *>(pCnf);
+    jint *pOut = reinterpret_cast<jint *>(env->GetDirectBufferAddress(buf));
+    jlong nInts = (jlong)p->nLiterals + p->nClauses;
+    int *pLit, *pStop, i;
+    jlong k = 0;
+
+    if (pOut == NULL || env->GetDirectBufferCapacity(buf) < (jlong)sizeof(jint) * nInts) {
+        return -1;
+    }
+    for ( i = 0; i < p->nClauses; i++ )
+    {
+        for ( pLit = p->pClauses[i], pStop = p->pClauses[i+1]; pLit < pStop; pLit++ )
+            pOut[k++] = Abc_LitIsCompl(*pLit) ? -(Abc_Lit2Var(*pLit) + 1) : Abc_Lit2Var(*pLit) + 1;
+        pOut[k++] = 0;
+    }
+    return k;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Cnf_1DataFree
+  (JNIEnv *env, jclass, jlong pCnf) {
+    ABC2JAVA_TRACE_CALL();
+    Cnf_DataFree( reinterpret_cast<Cnf_Dat_t *>(pCnf) );
+}
+
+
+//////////////////////////////////////
+// THREAD PLACEMENT
+//////////////////////////////////////
+
+/*
+ * Every native thread pool (portfolio engines, cuts, mfs partitions, pool
+ * workers) places thread i on cpu pCpus[i % nCpus], or leaves it to the
+ * scheduler when the list is empty. Pages are placed on the node of the
+ * thread that first touches them, so a pinned thread that builds its own
+ * data gets it on the local node. Each thread reports { cpu, node,
+ * status } as seen after pinning: status is 1 if pinned, 0 if not asked
+ * to be, and -errno if the affinity call failed (then the thread runs
+ * wherever the scheduler puts it); cpu and node are -1 where unknown.
+ */
+#define ABC2JAVA_PLACE_INTS 3
+
+// cpu list for the pools without one of their own (Abc_SetThreadCpus)
+static pthread_mutex_t abc2java_CpusMutex = PTHREAD_MUTEX_INITIALIZER;
+static Vec_Int_t * abc2java_vCpus = NULL;
+
+// copy of the global cpu list, with room for one more entry
+static int * abc2java_CpusRead( int * pnCpus )
+{
+    int * pCpus;
+    pthread_mutex_lock( &abc2java_CpusMutex );
+    *pnCpus = abc2java_vCpus ? Vec_IntSize(abc2java_vCpus) : 0;
+    pCpus = ABC_ALLOC( int, *pnCpus + 1 );
+    if ( *pnCpus )
+        memcpy( pCpus, Vec_IntArray(abc2java_vCpus), sizeof(int) * *pnCpus );
+    pthread_mutex_unlock( &abc2java_CpusMutex );
+    return pCpus;
+}
+
+// pins the calling thread; pPlace receives ABC2JAVA_PLACE_INTS entries
+static void abc2java_ThreadPlace( const int * pCpus, int nCpus, int iThread, int * pPlace )
+{
+    pPlace[0] = pPlace[1] = -1;
+    pPlace[2] = 0;
+#ifdef __linux__
+    cpu_set_t CpuSet;
+    unsigned Cpu, Node;
+    int Cpu0, Status;
+
+    if ( nCpus > 0 )
+    {
+        Cpu0 = pCpus[iThread % nCpus];
+        if ( Cpu0 < 0 || Cpu0 >= CPU_SETSIZE )
+            pPlace[2] = -EINVAL;
+        else
+        {
+            CPU_ZERO( &CpuSet );
+            CPU_SET( Cpu0, &CpuSet );
+            Status = pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t), &CpuSet );
+            pPlace[2] = Status ? -Status : 1;
+        }
+    }
+    if ( syscall( SYS_getcpu, &Cpu, &Node, NULL ) == 0 )
+    {
+        pPlace[0] = Cpu;
+        pPlace[1] = Node;
+    }
+#else
+    if ( nCpus > 0 )
+        pPlace[2] = -ENOSYS;
+#endif
+}
+
+/*
+ * Pools that also run on the calling (JVM) thread pin it only while they
+ * run: its affinity is saved before it is placed and restored afterwards.
+ */
+typedef struct abc2java_Affinity_t_
+{
+    int          fSaved;
+#ifdef __linux__
+    cpu_set_t    Set;
+#endif
+} abc2java_Affinity_t;
+
+static void abc2java_ThreadAffinitySave( abc2java_Affinity_t * p )
+{
+    p->fSaved = 0;
+#ifdef __linux__
+    p->fSaved = ( pthread_getaffinity_np( pthread_self(), sizeof(cpu_set_t), &p->Set ) == 0 );
+#endif
+}
+
+static void abc2java_ThreadAffinityRestore( abc2java_Affinity_t * p )
+{
+#ifdef __linux__
+    if ( p->fSaved )
+        pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t), &p->Set );
+#endif
+}
+
+/*
+ * Sets the cpu list of the cut, mfs and worker pools; an empty array turns
+ * pinning off. Portfolios keep their own list (Abc_PortfolioSetCpus).
+ */
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1SetThreadCpus
+  (JNIEnv *env, jclass, jintArray cpus) {
+    ABC2JAVA_TRACE_CALL();
+    int i, nCpus = env->GetArrayLength(cpus);
+    jint *pCpus = env->GetIntArrayElements(cpus, NULL);
+
+    if (pCpus == NULL) {
+        out_of_mem_exception(env);
+        return;
+    }
+    try {
+        pthread_mutex_lock( &abc2java_CpusMutex );
+        if ( abc2java_vCpus == NULL )
+            abc2java_vCpus = Vec_IntAlloc( nCpus );
+        Vec_IntClear( abc2java_vCpus );
+        for ( i = 0; i < nCpus; i++ )
+            Vec_IntPush( abc2java_vCpus, pCpus[i] );
+        pthread_mutex_unlock( &abc2java_CpusMutex );
+    } catch (std::bad_alloc &ba) {
+         pthread_mutex_unlock( &abc2java_CpusMutex );
+         out_of_mem_exception(env);
+    }
+    env->ReleaseIntArrayElements(cpus, pCpus, JNI_ABORT);
+}
+
+
+#ifndef ABC2JAVA_LEAN
+//////////////////////////////////////
+// SEQUENTIAL ENGINES
+//////////////////////////////////////
+
+/*
+ * Abc_NtkToDar treats don't-care initial values as 0, which would make
+ * the engines prove or refute a different design, so the entry points
+ * reject networks that have them.
+ */
+static int abc2java_NtkHasDcInits( Abc_Ntk_t * pNtk )
+{
+    Abc_Obj_t * pObj;
+    int i;
+
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        if ( Abc_LatchIsInitDc(pObj) )
+            return 1;
+    return 0;
+}
+
+/*
+ * Converts a sequential network into an Aig_Man_t with registers.
+ * Abc_NtkToDar expects the PIs in front of the latch outputs among the CIs,
+ * which does not hold when latches and PIs were created interleaved, so a
+ * copy is ordered and converted; the caller's CI and CO indices stay as
+ * they are, and PI i of the AIG is still Abc_NtkPi(pNtk, i).
+ */
+static Aig_Man_t * abc2java_NtkToSeqAig( Abc_Ntk_t * pNtk )
+{
+    Abc_Ntk_t * pNtkDup;
+    Aig_Man_t * pMan;
+
+    assert( !abc2java_NtkHasDcInits(pNtk) );
+    pNtkDup = Abc_NtkDup( pNtk );
+    Abc_NtkOrderCisCos( pNtkDup );
+    pMan = Abc_NtkToDar( pNtkDup, 0, 1 );
+    Abc_NtkDelete( pNtkDup );
+    return pMan;
+}
+
+/*
+ * Moves the counter-example found by an engine from the AIG to the network,
+ * replacing the one left by a previous run.
+ */
+static void abc2java_NtkTakeCex( Abc_Ntk_t * pNtk, Aig_Man_t * pMan )
+{
+    if ( pNtk->pSeqModel )
+        Abc_CexFree( pNtk->pSeqModel );
+    pNtk->pSeqModel = pMan->pSeqModel;
+    pMan->pSeqModel = NULL;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsGetDefault
+  (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        ABC_FREE( pdrParams.pInvFileName );
+        Pdr_ManSetDefaultParams( &pdrParams );
+        result = reinterpret_cast<jlong>( &pdrParams );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsSet_1nTimeOut
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Pdr_Par_t *>(pParams))->nTimeOut = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsSet_1nFrameMax
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Pdr_Par_t *>(pParams))->nFrameMax = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsSet_1nConfLimit
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Pdr_Par_t *>(pParams))->nConfLimit = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsSet_1fVerbose
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Pdr_Par_t *>(pParams))->fVerbose = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+/*
+ * When the property is proved, PDR writes the inductive invariant to this
+ * file as a PLA over the register outputs (one cube per blocked clause).
+ * A null name disables the dump.
+ */
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Pdr_1ParamsSetInvFile
+  (JNIEnv *env, jclass, jlong pParams, jstring name) {
+    ABC2JAVA_TRACE_CALL();
+    Pdr_Par_t *pPars = reinterpret_cast<Pdr_Par_t *>(pParams);
+
+    ABC_FREE( pPars->pInvFileName );
+    pPars->fDumpInv = 0;
+    if (name == NULL) {
+        return;
+    }
+    const char *s = env->GetStringUTFChars(name, NULL);
+    if (s == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        try {
+            pPars->pInvFileName = Abc_UtilStrsav( (char *)s );
+            pPars->fDumpInv = 1;
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+        env->ReleaseStringUTFChars(name, s);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Bmc_1ParamsGetDefault
+  (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        Saig_ParBmcSetDefaultParams( &bmcParams );
+        result = reinterpret_cast<jlong>( &bmcParams );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Bmc_1ParamsSet_1nTimeOut
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Saig_ParBmc_t *>(pParams))->nTimeOut = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Bmc_1ParamsSet_1nFramesMax
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Saig_ParBmc_t *>(pParams))->nFramesMax = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Bmc_1ParamsSet_1nConfLimit
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Saig_ParBmc_t *>(pParams))->nConfLimit = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Bmc_1ParamsSet_1fVerbose
+  (JNIEnv *env, jclass, jlong pParams, jint n) {
+    ABC2JAVA_TRACE_CALL();
+    try {
+        ( reinterpret_cast<Saig_ParBmc_t *>(pParams))->fVerbose = n;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+/*
+ * The engines below check that all POs of a strashed network with latches
+ * are always 0. They return 1 if proved, 0 if a counter-example was found
+ * (readable with Abc_NtkCex*), and -1 if undecided within the limits.
+ */
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPdr
+  (JNIEnv *env, jclass, jlong pAig, jlong pParams) {
+    ABC2JAVA_TRACE_TIMED();
+    jint result = -1;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Aig_Man_t *pMan;
+
+    if (abc2java_NtkHasDcInits(pNtk)) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        pMan = abc2java_NtkToSeqAig( pNtk );
+        // PDR leaves the invariant of a proof in the frame (Abc_NtkPdrInvariant)
+        if ( Abc_FrameReadGlobalFrame() )
+            Abc_FrameSetInv( NULL );
+        result = Pdr_ManSolve( pMan, reinterpret_cast<Pdr_Par_t *>(pParams) );
+        abc2java_NtkTakeCex( pNtk, pMan );
+        Aig_ManStop( pMan );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Inductive invariant of the last Abc_NtkPdr proof on pNtk, as the cubes
+ * it blocks: { nCubes, then per cube nLits, lits }, where lit 2*i+c is
+ * latch i (Abc_NtkLatch order) being 1 (c = 0) or 0 (c = 1); the invariant
+ * is the conjunction of the negated cubes. PDR keeps it in the frame in
+ * the encoding of abc2java_NtkToSeqAig, whose init-1 registers are
+ * complemented, so those literals are flipped back. NULL if the last run
+ * proved nothing.
+ */
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkPdrInvariant
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Vec_Int_t *vInv = Abc_FrameReadGlobalFrame() ? Abc_FrameReadInv( Abc_FrameReadGlobalFrame() ) : NULL;
+    Vec_Int_t *vRes;
+    jintArray result = NULL;
+    int i, k, nLits, Lit;
+
+    if (vInv == NULL) {
+        return NULL;
+    }
+    // the frame is shared, so the layout is checked against this network
+    if (Vec_IntSize(vInv) < 2 || Vec_IntEntryLast(vInv) != Abc_NtkLatchNum(pNtk) || Vec_IntEntry(vInv, 0) < 0) {
+        standard_exception(env);
+        return NULL;
+    }
+    for ( i = 1, k = 0; k < Vec_IntEntry(vInv, 0); k++, i += 1 + nLits )
+    {
+        nLits = i < Vec_IntSize(vInv) - 1 ? Vec_IntEntry(vInv, i) : -1;
+        if ( nLits < 0 || i + nLits >= Vec_IntSize(vInv) - 1 ) {
+            standard_exception(env);
+            return NULL;
+        }
+        for ( Lit = 0; Lit < nLits; Lit++ )
+            if ( Vec_IntEntry(vInv, i + 1 + Lit) < 0 || Abc_Lit2Var(Vec_IntEntry(vInv, i + 1 + Lit)) >= Abc_NtkLatchNum(pNtk) ) {
+                standard_exception(env);
+                return NULL;
+            }
+    }
+    try {
+        vRes = Vec_IntAlloc( Vec_IntSize(vInv) - 1 );
+        Vec_IntPush( vRes, Vec_IntEntry(vInv, 0) );
+        for ( i = 1, k = 0; k < Vec_IntEntry(vInv, 0); k++ )
+        {
+            nLits = Vec_IntEntry( vInv, i++ );
+            Vec_IntPush( vRes, nLits );
+            for ( ; nLits > 0; nLits-- )
+            {
+                Lit = Vec_IntEntry( vInv, i++ );
+                Vec_IntPush( vRes, Abc_LitNotCond(Lit, Abc_LatchIsInit1(Abc_NtkLatch(pNtk, Abc_Lit2Var(Lit)))) );
+            }
+        }
+        result = convertToIntArray(env, vRes);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkBmc3
+  (JNIEnv *env, jclass, jlong pAig, jlong pParams) {
+    ABC2JAVA_TRACE_TIMED();
+    jint result = -1;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Aig_Man_t *pMan;
+
+    if (abc2java_NtkHasDcInits(pNtk)) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        pMan = abc2java_NtkToSeqAig( pNtk );
+        result = Saig_ManBmcScalable( pMan, reinterpret_cast<Saig_ParBmc_t *>(pParams) );
+        abc2java_NtkTakeCex( pNtk, pMan );
+        Aig_ManStop( pMan );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Simple k-induction up to nFramesMax frames; nTimeOut is in seconds for
+ * both steps together, 0 means no limit. Saig_ManInduction only checks the
+ * inductive step, so BMC first covers the base case of every depth it may
+ * use; a failure there is a real counter-example. A failed inductive step
+ * only gives a counter-example to induction from an unreachable state, so
+ * it is reported as undecided and not kept.
+ */
+static int abc2java_NtkInduction( Abc_Ntk_t * pNtk, int nTimeOut, int nFramesMax, int nConfMax, int fUnique )
+{
+    Saig_ParBmc_t Pars;
+    Aig_Man_t * pMan;
+    time_t Start = time( NULL );
+    int RetValue;
+
+    pMan = abc2java_NtkToSeqAig( pNtk );
+    Saig_ParBmcSetDefaultParams( &Pars );
+    Pars.nFramesMax = nFramesMax;
+    Pars.nConfLimit = nConfMax;
+    Pars.nTimeOut   = nTimeOut;
+    Pars.fSilent    = 1;
+    RetValue = Saig_ManBmcScalable( pMan, &Pars );
+    abc2java_NtkTakeCex( pNtk, pMan );
+    if ( RetValue == 0 || Pars.iFrame < nFramesMax - 1 )
+    {
+        Aig_ManStop( pMan );
+        return RetValue == 0 ? 0 : -1;
+    }
+    if ( nTimeOut > 0 )
+    {
+        nTimeOut -= (int)(time( NULL ) - Start);
+        if ( nTimeOut <= 0 )
+        {
+            Aig_ManStop( pMan );
+            return -1;
+        }
+    }
+    RetValue = Saig_ManInduction( pMan, nTimeOut, nFramesMax, nConfMax, fUnique, 0, 0, 0, 0 );
+    Aig_ManStop( pMan );
+    return RetValue == 1 ? 1 : -1;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkInduction
+  (JNIEnv *env, jclass, jlong pAig, jint nTimeOut, jint nFramesMax, jint nConfMax, jboolean fUnique) {
+    ABC2JAVA_TRACE_TIMED();
+    jint result = -1;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+
+    if (nFramesMax < 1 || abc2java_NtkHasDcInits(pNtk)) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        result = abc2java_NtkInduction( pNtk, nTimeOut, nFramesMax, nConfMax, fUnique );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Counter-example of the last engine run: the failing frame and PO
+ * (-1 if there is none), the initial register values, and the PI values
+ * of frames 0..iFrame flattened frame by frame.
+ *
+ * Abc_NtkToDar complements the registers of init-1 latches, so the AIG
+ * starts from all zeros and the register bits of the counter-example are
+ * in that encoding; Abc_NtkCexInit flips them back, latch by latch in
+ * Abc_NtkLatch order (the register order of abc2java_NtkToSeqAig).
+ */
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCexFrame
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Cex_t *pCex = reinterpret_cast<Abc_Ntk_t *>(pAig)->pSeqModel;
+    return pCex ? pCex->iFrame : -1;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCexPo
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Cex_t *pCex = reinterpret_cast<Abc_Ntk_t *>(pAig)->pSeqModel;
+    return pCex ? pCex->iPo : -1;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCexInit
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Abc_Cex_t *pCex = pNtk->pSeqModel;
+    Vec_Int_t *vBits;
+    int i;
+
+    if (pCex == NULL) {
+        return NULL;
+    }
+    if (pCex->nRegs != Abc_NtkLatchNum(pNtk)) {
+        standard_exception(env);
+        return NULL;
+    }
+    try {
+        vBits = Vec_IntAlloc( pCex->nRegs );
+        for ( i = 0; i < pCex->nRegs; i++ )
+            Vec_IntPush( vBits, Abc_InfoHasBit(pCex->pData, i) ^ Abc_LatchIsInit1(Abc_NtkLatch(pNtk, i)) );
+        result = convertToIntArray(env, vBits);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCexInputs
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    Abc_Cex_t *pCex = reinterpret_cast<Abc_Ntk_t *>(pAig)->pSeqModel;
+    Vec_Int_t *vBits;
+    int i, nBits;
+
+    if (pCex == NULL) {
+        return NULL;
+    }
+    try {
+        nBits = (pCex->iFrame + 1) * pCex->nPis;
+        vBits = Vec_IntAlloc( nBits );
+        for ( i = 0; i < nBits; i++ )
+            Vec_IntPush( vBits, Abc_InfoHasBit(pCex->pData, pCex->nRegs + i) );
+        result = convertToIntArray(env, vBits);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+
+//////////////////////////////////////
+// PORTFOLIO
+//////////////////////////////////////
+
+/*
+ * A portfolio races several engine configurations on private copies of a
+ * network, one thread per engine, and returns the first conclusive answer.
+ *
+ * Each Solve starts a run that holds by-value copies of the configurations;
+ * the run is reference counted, so Solve can return while engines finish
+ * in the background. PDR and BMC are cancelled through pFuncStop, and the
+ * SAT engine (&cec) stops at the time limit of the Solve. FRAIG and Ivy
+ * FRAIG have no stop hook and are bounded only by their conflict limits.
+ * Their threads are therefore joined: the finished runs of a portfolio at
+ * its next Solve, all of its runs when it is stopped, and every run left
+ * when Abc_Stop tears down the frame.
+ */
+#define ABC2JAVA_PORT_FRAIG     0
+#define ABC2JAVA_PORT_IVYFRAIG  1
+#define ABC2JAVA_PORT_SAT       2
+#define ABC2JAVA_PORT_PDR       3
+#define ABC2JAVA_PORT_BMC3      4
+
+#define ABC2JAVA_PORT_SLOTS     256
+
+typedef struct abc2java_PortEngine_t_ abc2java_PortEngine_t;
+typedef struct abc2java_Portfolio_t_  abc2java_Portfolio_t;
+typedef struct abc2java_PortRun_t_    abc2java_PortRun_t;
+typedef struct abc2java_PortTask_t_   abc2java_PortTask_t;
+
+struct abc2java_PortEngine_t_
+{
+    int              Type;
+    int              nConfLimit;     // Ivy FRAIG and SAT
+    int              fDoSparse;      // Ivy FRAIG
+    Fraig_Params_t   FraigPars;
+    Pdr_Par_t        PdrPars;
+    Saig_ParBmc_t    BmcPars;
+};
+
+struct abc2java_Portfolio_t_
+{
+    Vec_Ptr_t *      vEngines;       // abc2java_PortEngine_t
+    Vec_Int_t *      vCpus;          // engine i runs on vCpus[i % size]; empty: not pinned
+    Vec_Int_t *      vPlacement;     // cpu, NUMA node and status per engine in the last run
+    int              Winner;         // engine of the last conclusive answer
+    int              Result;
+};
+
+struct abc2java_PortTask_t_
+{
+    abc2java_PortRun_t * pRun;
+    int              iEngine;
+};
+
+struct abc2java_PortRun_t_
+{
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+    int              nEngines;
+    abc2java_PortEngine_t * pEngines;
+    abc2java_PortTask_t *   pTasks;
+    Abc_Ntk_t *      pNtkMaster;     // copy of the input, duplicated by each worker
+    Abc_Ntk_t **     pNtks;          // private copy per engine
+    pthread_mutex_t  DupMutex;       // Abc_NtkDup writes pCopy of the master
+    int *            pCpus;
+    int              nCpus;
+    int *            pPlacement;     // ABC2JAVA_PLACE_INTS per engine, -1 until the worker starts
+    int              nRefs;          // engines still running + the solver
+    int              nDone;
+    int              Winner;
+    int              Result;
+    int              RunId;          // stop slot, -1 if none was free
+    int              nTimeLimit;     // seconds, for the engines with a time limit
+    Abc_Cex_t *      pCex;           // counter-example of the winner
+    pthread_t *      pThreads;
+    int *            pStarted;       // pThreads[i] is to be joined
+    void *           pOwner;         // the portfolio, only compared
+};
+
+static pthread_mutex_t abc2java_PortSlotMutex = PTHREAD_MUTEX_INITIALIZER;
+static Vec_Ptr_t * abc2java_PortRuns = NULL;       // runs whose threads are not joined yet
+static int abc2java_PortSlotUsed[ABC2JAVA_PORT_SLOTS];
+static volatile int abc2java_PortSlotStop[ABC2JAVA_PORT_SLOTS];
+
+static int abc2java_PortSlotAcquire()
+{
+    int i, RunId = -1;
+    pthread_mutex_lock( &abc2java_PortSlotMutex );
+    for ( i = 0; i < ABC2JAVA_PORT_SLOTS; i++ )
+        if ( !abc2java_PortSlotUsed[i] )
+        {
+            abc2java_PortSlotUsed[i] = 1;
+            abc2java_PortSlotStop[i] = 0;
+            RunId = i;
+            break;
+        }
+    pthread_mutex_unlock( &abc2java_PortSlotMutex );
+    return RunId;
+}
+
+static void abc2java_PortSlotRelease( int RunId )
+{
+    if ( RunId < 0 )
+        return;
+    pthread_mutex_lock( &abc2java_PortSlotMutex );
+    abc2java_PortSlotUsed[RunId] = 0;
+    pthread_mutex_unlock( &abc2java_PortSlotMutex );
+}
+
+// stop callback polled by PDR and BMC
+static int abc2java_PortSlotIsStopped( int RunId )
+{
+    return RunId >= 0 && RunId < ABC2JAVA_PORT_SLOTS && abc2java_PortSlotStop[RunId];
+}
+
+static Gia_Man_t * abc2java_GiaFromNtk( Abc_Ntk_t * pNtk );
+
+static abc2java_PortEngine_t * abc2java_PortfolioAddEngine( abc2java_Portfolio_t * p, int Type )
+{
+    abc2java_PortEngine_t * pEng = ABC_CALLOC( abc2java_PortEngine_t, 1 );
+    pEng->Type = Type;
+    Vec_PtrPush( p->vEngines, pEng );
+    return pEng;
+}
+
+/*
+ * Runs one engine on its copy of the network; 1 proved, 0 failed, -1 undecided.
+ * The combinational engines treat latch outputs as free inputs, so on a
+ * sequential network only their proofs are conclusive.
+ */
+static int abc2java_PortEngineRun( abc2java_PortEngine_t * pEng, Abc_Ntk_t * pNtk, int RunId, int nTimeLimit )
+{
+    Abc_Ntk_t * pNtkRes;
+    Aig_Man_t * pMan;
+    Gia_Man_t * pGia;
+    Cec_ParCec_t CecPars;
+    int fSeq = Abc_NtkLatchNum(pNtk) > 0;
+    int RetValue = -1;
+
+    switch ( pEng->Type )
+    {
+    case ABC2JAVA_PORT_FRAIG:
+        pNtkRes = Abc_NtkFraig( pNtk, &pEng->FraigPars, 0, 0 );
+        if ( pNtkRes )
+        {
+            RetValue = Abc_NtkMiterIsConstant( pNtkRes );
+            Abc_NtkDelete( pNtkRes );
+        }
+        break;
+    case ABC2JAVA_PORT_IVYFRAIG:
+        pNtkRes = Abc_NtkIvyFraig( pNtk, pEng->nConfLimit, pEng->fDoSparse, 1, 0, 0 );
+        if ( pNtkRes )
+        {
+            RetValue = Abc_NtkMiterIsConstant( pNtkRes );
+            Abc_NtkDelete( pNtkRes );
+        }
+        break;
+    case ABC2JAVA_PORT_SAT:
+        if ( fSeq )
+            break;
+        Cec_ManCecSetDefaultParams( &CecPars );
+        CecPars.nBTLimit = pEng->nConfLimit;
+        CecPars.nTimeLimit = nTimeLimit;
+        CecPars.fSilent = 1;
+        pGia = abc2java_GiaFromNtk( pNtk );
+        RetValue = Cec_ManVerify( pGia, &CecPars );
+        Gia_ManStop( pGia );
+        // Cec_ManVerify answers 1 proved, 0 failed, -1 undecided, like the miter check
+        break;
+    case ABC2JAVA_PORT_PDR:
+        if ( !fSeq )
+            break;
+        if ( RunId >= 0 )
+        {
+            pEng->PdrPars.RunId = RunId;
+            pEng->PdrPars.pFuncStop = abc2java_PortSlotIsStopped;
+        }
+        pMan = abc2java_NtkToSeqAig( pNtk );
+        RetValue = Pdr_ManSolve( pMan, &pEng->PdrPars );
+        abc2java_NtkTakeCex( pNtk, pMan );
+        Aig_ManStop( pMan );
+        return RetValue;
+    case ABC2JAVA_PORT_BMC3:
+        if ( !fSeq )
+            break;
+        if ( RunId >= 0 )
+        {
+            pEng->BmcPars.RunId = RunId;
+            pEng->BmcPars.pFuncStop = abc2java_PortSlotIsStopped;
+        }
+        pMan = abc2java_NtkToSeqAig( pNtk );
+        RetValue = Saig_ManBmcScalable( pMan, &pEng->BmcPars );
+        abc2java_NtkTakeCex( pNtk, pMan );
+        Aig_ManStop( pMan );
+        return RetValue;
+    }
+    if ( fSeq && RetValue == 0 )
+        RetValue = -1;
+    return RetValue;
+}
+
+static void abc2java_PortRunFree( abc2java_PortRun_t * pRun )
+{
+    abc2java_PortSlotRelease( pRun->RunId );
+    if ( pRun->pCex )
+        Abc_CexFree( pRun->pCex );
+    if ( pRun->pNtkMaster )
+        Abc_NtkDelete( pRun->pNtkMaster );
+    pthread_mutex_destroy( &pRun->Mutex );
+    pthread_mutex_destroy( &pRun->DupMutex );
+    pthread_cond_destroy( &pRun->Cond );
+    ABC_FREE( pRun->pEngines );
+    ABC_FREE( pRun->pTasks );
+    ABC_FREE( pRun->pNtks );
+    ABC_FREE( pRun->pCpus );
+    ABC_FREE( pRun->pPlacement );
+    ABC_FREE( pRun->pThreads );
+    ABC_FREE( pRun->pStarted );
+    ABC_FREE( pRun );
+}
+
+// drops one reference; the last one frees the run
+static void abc2java_PortRunRelease( abc2java_PortRun_t * pRun )
+{
+    int fFree;
+    pthread_mutex_lock( &pRun->Mutex );
+    fFree = ( --pRun->nRefs == 0 );
+    pthread_mutex_unlock( &pRun->Mutex );
+    if ( fFree )
+        abc2java_PortRunFree( pRun );
+}
+
+static void abc2java_PortRunDone( abc2java_PortRun_t * pRun, int iEngine, int Result )
+{
+    Abc_Ntk_t * pNtk = pRun->pNtks[iEngine];
+
+    pthread_mutex_lock( &pRun->Mutex );
+    pRun->nDone++;
+    if ( Result != -1 && pRun->Winner == -1 )
+    {
+        pRun->Winner = iEngine;
+        pRun->Result = Result;
+        if ( Result == 0 && pNtk && pNtk->pSeqModel )
+        {
+            pRun->pCex = pNtk->pSeqModel;
+            pNtk->pSeqModel = NULL;
+        }
+        if ( pRun->RunId >= 0 )
+            abc2java_PortSlotStop[pRun->RunId] = 1;
+    }
+    pthread_cond_signal( &pRun->Cond );
+    pthread_mutex_unlock( &pRun->Mutex );
+
+    pRun->pNtks[iEngine] = NULL;
+    if ( pNtk )
+        Abc_NtkDelete( pNtk );
+    abc2java_PortRunRelease( pRun );
+}
+
+/*
+ * Pins the calling worker to its cpu, if any, and records where it runs
+ * (see THREAD PLACEMENT). A pinned worker copies the network itself, so
+ * the copy and the managers the engines build from it are node-local.
+ */
+static void abc2java_PortPlace( abc2java_PortRun_t * pRun, int iEngine )
+{
+    int pPlace[ABC2JAVA_PLACE_INTS];
+
+    abc2java_ThreadPlace( pRun->pCpus, pRun->nCpus, iEngine, pPlace );
+    pthread_mutex_lock( &pRun->Mutex );
+    memcpy( pRun->pPlacement + ABC2JAVA_PLACE_INTS * iEngine, pPlace, sizeof(pPlace) );
+    pthread_mutex_unlock( &pRun->Mutex );
+}
+
+static void * abc2java_PortWorker( void * pArg )
+{
+    abc2java_PortTask_t * pTask = (abc2java_PortTask_t *)pArg;
+    abc2java_PortRun_t * pRun = pTask->pRun;
+    Abc_Ntk_t * pNtk;
+    int Result = -1;
+
+    abc2java_PortPlace( pRun, pTask->iEngine );
+    pthread_mutex_lock( &pRun->DupMutex );
+    pNtk = Abc_NtkDup( pRun->pNtkMaster );
+    pthread_mutex_unlock( &pRun->DupMutex );
+    pRun->pNtks[pTask->iEngine] = pNtk;
+    try {
+        Result = abc2java_PortEngineRun( pRun->pEngines + pTask->iEngine, pNtk, pRun->RunId, pRun->nTimeLimit );
+    } catch (std::bad_alloc &ba) {
+        Result = -1;
+    }
+    abc2java_PortRunDone( pRun, pTask->iEngine, Result );
+    return NULL;
+}
+
+/*
+ * Joins the threads of the runs of pOwner (of all runs if NULL) and drops
+ * the references the registry holds; with fAll unset only the runs whose
+ * engines have all finished are taken, so nothing blocks.
+ */
+static void abc2java_PortRunsJoin( void * pOwner, int fAll )
+{
+    abc2java_PortRun_t * pRun;
+    Vec_Ptr_t * vJoin = Vec_PtrAlloc( 4 );
+    int i, k, fDone;
+
+    pthread_mutex_lock( &abc2java_PortSlotMutex );
+    if ( abc2java_PortRuns )
+    {
+        k = 0;
+        Vec_PtrForEachEntry( abc2java_PortRun_t *, abc2java_PortRuns, pRun, i )
+        {
+            pthread_mutex_lock( &pRun->Mutex );
+            fDone = ( pRun->nDone == pRun->nEngines );
+            pthread_mutex_unlock( &pRun->Mutex );
+            if ( (pOwner == NULL || pRun->pOwner == pOwner) && (fAll || fDone) )
+                Vec_PtrPush( vJoin, pRun );
+            else
+                Vec_PtrWriteEntry( abc2java_PortRuns, k++, pRun );
+        }
+        Vec_PtrShrink( abc2java_PortRuns, k );
+    }
+    pthread_mutex_unlock( &abc2java_PortSlotMutex );
+
+    Vec_PtrForEachEntry( abc2java_PortRun_t *, vJoin, pRun, i )
+    {
+        if ( pRun->RunId >= 0 )
+            abc2java_PortSlotStop[pRun->RunId] = 1;
+        for ( k = 0; k < pRun->nEngines; k++ )
+            if ( pRun->pStarted[k] )
+                pthread_join( pRun->pThreads[k], NULL );
+        abc2java_PortRunRelease( pRun );
+    }
+    Vec_PtrFree( vJoin );
+}
+
+/*
+ * Races all engines of the portfolio on copies of pNtk. Waits until one is
+ * conclusive, all have given up, or nTimeOutMs expires (0 for no limit).
+ * A counter-example of the winning sequential engine is moved to pNtk.
+ */
+static int abc2java_PortfolioSolve( abc2java_Portfolio_t * p, Abc_Ntk_t * pNtk, int nTimeOutMs )
+{
+    abc2java_PortRun_t * pRun;
+    abc2java_PortEngine_t * pEng;
+    struct timespec Deadline;
+    int i, nEngines = Vec_PtrSize( p->vEngines );
+
+    p->Winner = -1;
+    p->Result = -1;
+    abc2java_PortRunsJoin( p, 0 );
+    if ( nEngines == 0 )
+        return -1;
+
+    pRun = ABC_CALLOC( abc2java_PortRun_t, 1 );
+    pthread_mutex_init( &pRun->Mutex, NULL );
+    pthread_cond_init( &pRun->Cond, NULL );
+    pRun->nEngines = nEngines;
+    pRun->pEngines = ABC_ALLOC( abc2java_PortEngine_t, nEngines );
+    pRun->pTasks   = ABC_ALLOC( abc2java_PortTask_t, nEngines );
+    pRun->pNtks    = ABC_CALLOC( Abc_Ntk_t *, nEngines );
+    pRun->pNtkMaster = Abc_NtkDup( pNtk );
+    pthread_mutex_init( &pRun->DupMutex, NULL );
+    pRun->nCpus    = Vec_IntSize( p->vCpus );
+    pRun->pCpus    = ABC_ALLOC( int, pRun->nCpus + 1 );
+    memcpy( pRun->pCpus, Vec_IntArray(p->vCpus), sizeof(int) * pRun->nCpus );
+    pRun->pPlacement = ABC_ALLOC( int, ABC2JAVA_PLACE_INTS * nEngines );
+    for ( i = 0; i < ABC2JAVA_PLACE_INTS * nEngines; i++ )
+        pRun->pPlacement[i] = -1;
+    pRun->pThreads = ABC_ALLOC( pthread_t, nEngines );
+    pRun->pStarted = ABC_CALLOC( int, nEngines );
+    pRun->pOwner   = p;
+    pRun->nTimeLimit = nTimeOutMs > 0 ? (nTimeOutMs + 999) / 1000 : 0;
+    // one reference per engine, the solver, and the registry until joined
+    pRun->nRefs    = nEngines + 2;
+    pRun->Winner   = -1;
+    pRun->Result   = -1;
+    pRun->RunId    = abc2java_PortSlotAcquire();
+    // the workers copy the master, so the original can go once Solve returns
+    Vec_PtrForEachEntry( abc2java_PortEngine_t *, p->vEngines, pEng, i )
+    {
+        pRun->pEngines[i] = *pEng;
+        pRun->pTasks[i].pRun = pRun;
+        pRun->pTasks[i].iEngine = i;
+    }
+    pthread_mutex_lock( &abc2java_PortSlotMutex );
+    if ( abc2java_PortRuns == NULL )
+        abc2java_PortRuns = Vec_PtrAlloc( 4 );
+    Vec_PtrPush( abc2java_PortRuns, pRun );
+    pthread_mutex_unlock( &abc2java_PortSlotMutex );
+    for ( i = 0; i < nEngines; i++ )
+        if ( pthread_create( pRun->pThreads + i, NULL, abc2java_PortWorker, pRun->pTasks + i ) == 0 )
+            pRun->pStarted[i] = 1;
+        else
+            abc2java_PortRunDone( pRun, i, -1 );
+
+    if ( nTimeOutMs > 0 )
+    {
+        clock_gettime( CLOCK_REALTIME, &Deadline );
+        Deadline.tv_sec  += nTimeOutMs / 1000;
+        Deadline.tv_nsec += (long)(nTimeOutMs % 1000) * 1000000;
+        if ( Deadline.tv_nsec >= 1000000000 )
+        {
+            Deadline.tv_sec++;
+            Deadline.tv_nsec -= 1000000000;
+        }
+    }
+    pthread_mutex_lock( &pRun->Mutex );
+    while ( pRun->Winner == -1 && pRun->nDone < nEngines )
+    {
+        if ( nTimeOutMs <= 0 )
+            pthread_cond_wait( &pRun->Cond, &pRun->Mutex );
+        else if ( pthread_cond_timedwait( &pRun->Cond, &pRun->Mutex, &Deadline ) == ETIMEDOUT )
+            break;
+    }
+    if ( pRun->RunId >= 0 )
+        abc2java_PortSlotStop[pRun->RunId] = 1;
+    p->Winner = pRun->Winner;
+    p->Result = pRun->Result;
+    Vec_IntClear( p->vPlacement );
+    for ( i = 0; i < ABC2JAVA_PLACE_INTS * nEngines; i++ )
+        Vec_IntPush( p->vPlacement, pRun->pPlacement[i] );
+    if ( pRun->pCex )
+    {
+        if ( pNtk->pSeqModel )
+            Abc_CexFree( pNtk->pSeqModel );
+        pNtk->pSeqModel = pRun->pCex;
+        pRun->pCex = NULL;
+    }
+    pthread_mutex_unlock( &pRun->Mutex );
+    abc2java_PortRunRelease( pRun );
+    return p->Result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioStart
+  (JNIEnv *env, jclass) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+    abc2java_Portfolio_t *p;
+
+    try {
+        p = ABC_CALLOC( abc2java_Portfolio_t, 1 );
+        p->vEngines = Vec_PtrAlloc( 8 );
+        p->vCpus = Vec_IntAlloc( 0 );
+        p->vPlacement = Vec_IntAlloc( 0 );
+        p->Winner = -1;
+        p->Result = -1;
+        result = reinterpret_cast<jlong>(p);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioStop
+  (JNIEnv *env, jclass, jlong pPort) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+
+    try {
+        // waits for the engines of earlier runs that are still going
+        abc2java_PortRunsJoin( p, 1 );
+        Vec_PtrFreeFree( p->vEngines );
+        Vec_IntFree( p->vCpus );
+        Vec_IntFree( p->vPlacement );
+        ABC_FREE( p );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+/*
+ * The Add functions copy the parameters, so the global parameter objects
+ * can be changed and added again. They return the index of the engine.
+ */
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioAddFraig
+  (JNIEnv *env, jclass, jlong pPort, jlong fParams) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+
+    try {
+        abc2java_PortfolioAddEngine( p, ABC2JAVA_PORT_FRAIG )->FraigPars = *reinterpret_cast<Fraig_Params_t *>(fParams);
+        result = Vec_PtrSize( p->vEngines ) - 1;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioAddIvyFraig
+  (JNIEnv *env, jclass, jlong pPort, jint nConfLimit, jboolean fDoSparse) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+    abc2java_PortEngine_t *pEng;
+
+    try {
+        pEng = abc2java_PortfolioAddEngine( p, ABC2JAVA_PORT_IVYFRAIG );
+        pEng->nConfLimit = nConfLimit;
+        pEng->fDoSparse = fDoSparse;
+        result = Vec_PtrSize( p->vEngines ) - 1;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioAddSat
+  (JNIEnv *env, jclass, jlong pPort, jint nConfLimit) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+
+    try {
+        abc2java_PortfolioAddEngine( p, ABC2JAVA_PORT_SAT )->nConfLimit = nConfLimit;
+        result = Vec_PtrSize( p->vEngines ) - 1;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioAddPdr
+  (JNIEnv *env, jclass, jlong pPort, jlong pParams) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+    abc2java_PortEngine_t *pEng;
+
+    try {
+        pEng = abc2java_PortfolioAddEngine( p, ABC2JAVA_PORT_PDR );
+        pEng->PdrPars = *reinterpret_cast<Pdr_Par_t *>(pParams);
+        // the file name belongs to the global parameters
+        pEng->PdrPars.fDumpInv = 0;
+        pEng->PdrPars.pInvFileName = NULL;
+        pEng->PdrPars.fSilent = 1;
+        result = Vec_PtrSize( p->vEngines ) - 1;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioAddBmc3
+  (JNIEnv *env, jclass, jlong pPort, jlong pParams) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+    abc2java_PortEngine_t *pEng;
+
+    try {
+        pEng = abc2java_PortfolioAddEngine( p, ABC2JAVA_PORT_BMC3 );
+        pEng->BmcPars = *reinterpret_cast<Saig_ParBmc_t *>(pParams);
+        pEng->BmcPars.fSilent = 1;
+        result = Vec_PtrSize( p->vEngines ) - 1;
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioSolve
+  (JNIEnv *env, jclass, jlong pPort, jlong pAig, jint nTimeOutMs) {
+    ABC2JAVA_TRACE_TIMED();
+    jint result = -1;
+
+    if (abc2java_NtkHasDcInits(reinterpret_cast<Abc_Ntk_t *>(pAig))) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        result = abc2java_PortfolioSolve( reinterpret_cast<abc2java_Portfolio_t *>(pPort),
+                                          reinterpret_cast<Abc_Ntk_t *>(pAig), nTimeOutMs );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Pins engine i of later runs to cpus[i % cpus.length]; an empty array
+ * turns pinning off. Each pinned worker copies the network itself, so its
+ * memory is allocated on the NUMA node of its cpu.
+ */
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioSetCpus
+  (JNIEnv *env, jclass, jlong pPort, jintArray cpus) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_Portfolio_t *p = reinterpret_cast<abc2java_Portfolio_t *>(pPort);
+    int i, nCpus = env->GetArrayLength(cpus);
+    jint *pCpus = env->GetIntArrayElements(cpus, NULL);
+
+    if (pCpus == NULL) {
+        out_of_mem_exception(env);
+        return;
+    }
+    Vec_IntClear( p->vCpus );
+    for ( i = 0; i < nCpus; i++ )
+        Vec_IntPush( p->vCpus, pCpus[i] );
+    env->ReleaseIntArrayElements(cpus, pCpus, JNI_ABORT);
+}
+
+/*
+ * { cpu, NUMA node, status } of each engine of the last run as seen when
+ * its worker started (see THREAD PLACEMENT); all -1 for workers that had
+ * not started.
+ */
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioReadPlacement
+  (JNIEnv *env, jclass, jlong pPort) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    Vec_Int_t *vPlacement = reinterpret_cast<abc2java_Portfolio_t *>(pPort)->vPlacement;
+
+    try {
+        result = convertToIntArray(env, Vec_IntDup( vPlacement ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PortfolioReadWinner
+  (JNIEnv *env, jclass, jlong pPort) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<abc2java_Portfolio_t *>(pPort)->Winner;
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// COMPACTION
+//////////////////////////////////////
+
+/*
+ * Neither Fraig nor Ivy managers shrink: Fraig never deletes nodes and Ivy
+ * keeps object ids and memory pages of deleted nodes. Compaction copies the
+ * cones of a root set (plus the manager's own POs) into a fresh manager,
+ * with the PIs recreated in order, and frees the old one. The roots array
+ * is rewritten with the handles of the copies, complement bits kept, so a
+ * 0 handle stays 0.
+ */
+
+/*
+ * Reads back the parameters a Fraig manager was created with.
+ */
+static void abc2java_FraigParamsRead( Fraig_Man_t * fMan, Fraig_Params_t * pParams )
+{
+    Fraig_ParamsSetDefault( pParams );
+    pParams->nPatsRand  = fMan->nWordsRand * 32;
+    pParams->nPatsDyna  = fMan->nWordsDyna * 32;
+    pParams->nBTLimit   = fMan->nBTLimit;
+    pParams->nSeconds   = fMan->nSeconds;
+    pParams->fFuncRed   = fMan->fFuncRed;
+    pParams->fFeedBack  = fMan->fFeedBack;
+    pParams->fDist1Pats = fMan->fDist1Pats;
+    pParams->fDoSparse  = fMan->fDoSparse;
+    pParams->fChoicing  = fMan->fChoicing;
+    pParams->fTryProve  = fMan->fTryProve;
+    pParams->fVerbose   = fMan->fVerbose;
+    pParams->fVerboseP  = fMan->fVerboseP;
+    pParams->nInspLimit = fMan->nInspLimit;
+}
+
+/*
+ * Copies the cone of pRoot; pMap is indexed by the old node numbers.
+ * Iterative, since the cones of long sessions can be very deep.
+ */
+static Fraig_Node_t * abc2java_FraigCopyCone( Fraig_Man_t * fNew, Fraig_Node_t * pRoot, Fraig_Node_t ** pMap, Vec_Ptr_t * vStack )
+{
+    Fraig_Node_t * pNode, * pChild0, * pChild1;
+
+    Vec_PtrClear( vStack );
+    Vec_PtrPush( vStack, Fraig_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pNode = (Fraig_Node_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pNode->Num] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pChild0 = pMap[Fraig_Regular(pNode->p1)->Num];
+        pChild1 = pMap[Fraig_Regular(pNode->p2)->Num];
+        if ( pChild0 && pChild1 )
+        {
+            pMap[pNode->Num] = Fraig_NodeAnd( fNew, Fraig_NotCond(pChild0, Fraig_IsComplement(pNode->p1)),
+                                                    Fraig_NotCond(pChild1, Fraig_IsComplement(pNode->p2)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( vStack, Fraig_Regular(pNode->p1) );
+        if ( pChild1 == NULL )
+            Vec_PtrPush( vStack, Fraig_Regular(pNode->p2) );
+    }
+    return Fraig_NotCond( pMap[Fraig_Regular(pRoot)->Num], Fraig_IsComplement(pRoot) );
+}
+
+/*
+ * Carries the filled dynamic simulation words of fOld (the patterns taken
+ * from SAT counter-examples) to the PIs of fNew, truncated to the dynamic
+ * width of fNew. Nodes created afterwards simulate them like any pattern.
+ */
+static void abc2java_FraigCarryDynamic( Fraig_Man_t * fOld, Fraig_Man_t * fNew )
+{
+    Fraig_Node_t * pOld, * pNew;
+    int i, w, nWords = Abc_MinInt( fOld->iWordStart, fNew->nWordsDyna );
+
+    for ( i = 0; i < fOld->vInputs->nSize; i++ )
+    {
+        pOld = fOld->vInputs->pArray[i];
+        pNew = fNew->vInputs->pArray[i];
+        pNew->uHashD = 0;
+        for ( w = 0; w < nWords; w++ )
+        {
+            pNew->puSimD[w] = pOld->puSimD[w];
+            pNew->uHashD ^= pNew->puSimD[w] * s_FraigPrimes[w];
+        }
+    }
+    // the words stay real patterns when the new manager compresses them
+    if ( fOld->pSimsReal && fNew->pSimsReal )
+        memcpy( fNew->pSimsReal, fOld->pSimsReal, sizeof(unsigned) * nWords );
+    fNew->iWordStart = nWords;
+}
+
+/*
+ * Copies the live part of fOld into a new manager created with pParams
+ * (the parameters of fOld if NULL) and frees fOld. The new manager starts
+ * with fresh random simulation patterns and the dynamic patterns of fOld;
+ * handles into fOld other than the roots are invalid afterwards.
+ */
+static Fraig_Man_t * abc2java_FraigCompact( Fraig_Man_t * fOld, jlong * pRoots, int nRoots, Fraig_Params_t * pParams )
+{
+    Fraig_Params_t Params;
+    Fraig_Man_t * fNew;
+    Fraig_Node_t ** pMap, ** pOuts;
+    Vec_Ptr_t * vStack;
+    int i, nOuts;
+
+    if ( pParams == NULL )
+    {
+        abc2java_FraigParamsRead( fOld, &Params );
+        pParams = &Params;
+    }
+    fNew = Fraig_ManCreate( pParams );
+    pMap = ABC_CALLOC( Fraig_Node_t *, fOld->vNodes->nSize );
+    pMap[fOld->pConst1->Num] = Fraig_ManReadConst1( fNew );
+    for ( i = 0; i < fOld->vInputs->nSize; i++ )
+        pMap[fOld->vInputs->pArray[i]->Num] = Fraig_ManReadIthVar( fNew, i );
+    abc2java_FraigCarryDynamic( fOld, fNew );
+
+    vStack = Vec_PtrAlloc( 100 );
+    for ( i = 0; i < nRoots; i++ )
+        if ( pRoots[i] )
+            pRoots[i] = reinterpret_cast<jlong>(abc2java_FraigCopyCone( fNew, reinterpret_cast<Fraig_Node_t *>(pRoots[i]), pMap, vStack ));
+    nOuts = Fraig_ManReadOutputNum( fOld );
+    pOuts = Fraig_ManReadOutputs( fOld );
+    for ( i = 0; i < nOuts; i++ )
+        Fraig_ManSetPo( fNew, abc2java_FraigCopyCone( fNew, pOuts[i], pMap, vStack ) );
+    Vec_PtrFree( vStack );
+    ABC_FREE( pMap );
+    // make sure every node has the carried words and is hashed by them,
+    // as after Fraig_FeedBack
+    if ( fNew->iWordStart > 0 )
+    {
+        for ( i = 1; i < fNew->vNodes->nSize; i++ )
+            if ( Fraig_NodeIsAnd(fNew->vNodes->pArray[i]) )
+                Fraig_NodeSimulate( fNew->vNodes->pArray[i], 0, fNew->iWordStart, 0 );
+        Fraig_TableRehashF0( fNew, 0 );
+    }
+    Fraig_ManFree( fOld );
+    return fNew;
+}
+
+/*
+ * Same for Ivy; pMap is indexed by the old object ids.
+ */
+static Ivy_Obj_t * abc2java_IvyCopyCone( Ivy_Man_t * pNew, Ivy_Obj_t * pRoot, Ivy_Obj_t ** pMap, Vec_Ptr_t * vStack )
+{
+    Ivy_Obj_t * pObj, * pChild0, * pChild1;
+
+    Vec_PtrClear( vStack );
+    Vec_PtrPush( vStack, Ivy_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pObj = (Ivy_Obj_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pObj->Id] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pChild0 = pMap[Ivy_ObjFanin0(pObj)->Id];
+        pChild1 = Ivy_ObjIsBuf(pObj) ? pChild0 : pMap[Ivy_ObjFanin1(pObj)->Id];
+        if ( pChild0 && pChild1 )
+        {
+            pChild0 = Ivy_NotCond( pChild0, Ivy_ObjFaninC0(pObj) );
+            if ( Ivy_ObjIsBuf(pObj) )
+                pMap[pObj->Id] = pChild0;
+            else if ( Ivy_ObjIsExor(pObj) )
+                pMap[pObj->Id] = Ivy_Exor( pNew, pChild0, Ivy_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            else
+                pMap[pObj->Id] = Ivy_And( pNew, pChild0, Ivy_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( vStack, Ivy_ObjFanin0(pObj) );
+        if ( pChild1 == NULL && !Ivy_ObjIsBuf(pObj) )
+            Vec_PtrPush( vStack, Ivy_ObjFanin1(pObj) );
+    }
+    return Ivy_NotCond( pMap[Ivy_Regular(pRoot)->Id], Ivy_IsComplement(pRoot) );
+}
+
+static Ivy_Man_t * abc2java_IvyCompact( Ivy_Man_t * pOld, jlong * pRoots, int nRoots )
+{
+    Ivy_Man_t * pNew;
+    Ivy_Obj_t ** pMap, * pObj;
+    Vec_Ptr_t * vStack;
+    int i;
+
+    assert( Ivy_ManLatchNum(pOld) == 0 );
+    pNew = Ivy_ManStart();
+    pMap = ABC_CALLOC( Ivy_Obj_t *, Ivy_ManObjIdMax(pOld) + 1 );
+    pMap[Ivy_ManConst1(pOld)->Id] = Ivy_ManConst1( pNew );
+    Ivy_ManForEachPi( pOld, pObj, i )
+        pMap[pObj->Id] = Ivy_ObjCreatePi( pNew );
+
+    vStack = Vec_PtrAlloc( 100 );
+    for ( i = 0; i < nRoots; i++ )
+        if ( pRoots[i] )
+            pRoots[i] = reinterpret_cast<jlong>(abc2java_IvyCopyCone( pNew, reinterpret_cast<Ivy_Obj_t *>(pRoots[i]), pMap, vStack ));
+    Ivy_ManForEachPo( pOld, pObj, i )
+        Ivy_ObjCreatePo( pNew, abc2java_IvyCopyCone( pNew, Ivy_ObjChild0(pObj), pMap, vStack ) );
+    Vec_PtrFree( vStack );
+    ABC_FREE( pMap );
+    Ivy_ManStop( pOld );
+    return pNew;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManCompact
+  (JNIEnv *env, jclass, jlong fAig, jlongArray roots) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+    jlong *pRoots = env->GetLongArrayElements(roots, NULL);
+
+    if (pRoots == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_FraigCompact( reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                                 pRoots, env->GetArrayLength(roots), NULL ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseLongArrayElements(roots, pRoots, 0);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManCompact
+  (JNIEnv *env, jclass, jlong fAig, jlongArray roots) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+    jlong *pRoots = env->GetLongArrayElements(roots, NULL);
+
+    if (pRoots == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_IvyCompact( reinterpret_cast<Ivy_Man_t *>(fAig),
+                                                               pRoots, env->GetArrayLength(roots) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseLongArrayElements(roots, pRoots, 0);
+    return result;
+}
+
+
+//////////////////////////////////////
+// SIMULATION PATTERNS
+//////////////////////////////////////
+
+/*
+ * The simulation info of a Fraig manager has a fixed number of words per
+ * node, so its width is changed by rebuilding the manager around a root set
+ * (see COMPACTION). The dynamic patterns found so far are carried over,
+ * the newest ones dropped if they do not fit nPatsDyna. With fFeedBack on,
+ * the manager turns every SAT counter-example into a new dynamic pattern.
+ * Both widths must be at least one word (32 patterns): the simulation code
+ * reads the first word of each kind unconditionally.
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManResizeSim
+  (JNIEnv *env, jclass, jlong fAig, jlongArray roots, jint nPatsRand, jint nPatsDyna) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+    Fraig_Params_t Params;
+    jlong *pRoots;
+
+    if (nPatsRand < 32 || nPatsDyna < 32) {
+        standard_exception(env);
+        return 0;
+    }
+    pRoots = env->GetLongArrayElements(roots, NULL);
+    if (pRoots == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    try {
+        abc2java_FraigParamsRead( fMan, &Params );
+        Params.nPatsRand = nPatsRand;
+        Params.nPatsDyna = nPatsDyna;
+        Params.fFeedBack = 1;
+        result = reinterpret_cast<jlong>(abc2java_FraigCompact( fMan, pRoots, env->GetArrayLength(roots), &Params ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseLongArrayElements(roots, pRoots, 0);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManSetFeedBack
+  (JNIEnv *env, jclass, jlong fAig, jboolean fFeedBack) {
+    ABC2JAVA_TRACE_CALL();
+    reinterpret_cast<Fraig_Man_t *>(fAig)->fFeedBack = fFeedBack;
+}
+
+/*
+ * { nWordsRand, nWordsDyna, dynamic words filled so far, SAT calls,
+ *   proofs, counter-examples, undecided }
+ */
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadSimStats
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+    Vec_Int_t *vStats;
+
+    try {
+        vStats = Vec_IntAlloc( 7 );
+        Vec_IntPush( vStats, fMan->nWordsRand );
+        Vec_IntPush( vStats, fMan->nWordsDyna );
+        Vec_IntPush( vStats, fMan->iWordStart );
+        Vec_IntPush( vStats, fMan->nSatCalls );
+        Vec_IntPush( vStats, fMan->nSatProof );
+        Vec_IntPush( vStats, fMan->nSatCounter );
+        Vec_IntPush( vStats, fMan->nSatFails );
+        result = convertToIntArray(env, vStats);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Conflicts of the manager's SAT solver over all its calls so far.
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManReadSatConflicts
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+    return fMan->pSat ? Msat_SolverReadBackTracks( fMan->pSat ) : 0;
+}
+
+
+/*
+ * Pattern quality: entry w is the number of classes the nodes fall into
+ * (up to complement) when only the first w+1 simulation words are used,
+ * the random words first and then the filled dynamic ones. The increments
+ * show how much each word refines the classes.
+ */
+static Vec_Int_t * abc2java_FraigSimClassCounts( Fraig_Man_t * fMan )
+{
+    Vec_Int_t * vCounts;
+    Fraig_Node_t * pNode;
+    uint64_t * pHashes, * pSorted;
+    unsigned Word, Mask;
+    int i, w, nNodes, nWords, nClasses;
+
+    nNodes = fMan->vNodes->nSize;
+    nWords = fMan->nWordsRand + fMan->iWordStart;
+    vCounts = Vec_IntAlloc( nWords );
+    pHashes = ABC_CALLOC( uint64_t, nNodes );
+    pSorted = ABC_ALLOC( uint64_t, nNodes );
+    for ( w = 0; w < nWords; w++ )
+    {
+        for ( i = 0; i < nNodes; i++ )
+        {
+            pNode = fMan->vNodes->pArray[i];
+            // the phase is fixed by the first random pattern
+            Mask = (pNode->puSimR[0] & 1) ? ~0u : 0u;
+            Word = w < fMan->nWordsRand ? pNode->puSimR[w] : pNode->puSimD[w - fMan->nWordsRand];
+            pHashes[i] = (pHashes[i] ^ (Word ^ Mask)) * 0x100000001B3ull;
+        }
+        memcpy( pSorted, pHashes, sizeof(uint64_t) * nNodes );
+        std::sort( pSorted, pSorted + nNodes );
+        for ( nClasses = 0, i = 0; i < nNodes; i++ )
+            nClasses += ( i == 0 || pSorted[i] != pSorted[i-1] );
+        Vec_IntPush( vCounts, nClasses );
+    }
+    ABC_FREE( pHashes );
+    ABC_FREE( pSorted );
+    return vCounts;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManSimClassCounts
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+
+    try {
+        result = convertToIntArray(env, abc2java_FraigSimClassCounts( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+
+//////////////////////////////////////
+// GIA
+//////////////////////////////////////
+
+/*
+ * Gia_Man_t keeps all objects in one array of 12-byte structs and refers
+ * to nodes by literals (2 * object id + complement), which is what the
+ * Java side sees as well. Every Gia handle returned here carries its
+ * structural hash table, so nodes can be added to it with the Hash calls;
+ * the engines leave their input untouched and return a new manager.
+ *
+ * The flat array form used for bulk transfer numbers variables as in
+ * AIGER: 0 is the constant, 1..nCis the CIs, then the AND nodes in
+ * topological order. ands holds two fanin literals per node, cos one
+ * literal per CO; the last nRegs CIs and COs are register outputs and
+ * inputs.
+ */
+
+static inline Gia_Man_t * abc2java_GiaHashed( Gia_Man_t * p )
+{
+    if ( p )
+        Gia_ManHashStart( p );
+    return p;
+}
+
+// checks that every fanin refers to an earlier variable
+static int abc2java_GiaArraysValid( int nCis, int nRegs, const jint * pAnds, int nAnds, const jint * pCos, int nCos )
+{
+    int i;
+    if ( nCis < 0 || nRegs < 0 || nRegs > nCis || nRegs > nCos )
+        return 0;
+    for ( i = 0; i < 2 * nAnds; i++ )
+        if ( pAnds[i] < 0 || Abc_Lit2Var(pAnds[i]) > nCis + i / 2 )
+            return 0;
+    for ( i = 0; i < nCos; i++ )
+        if ( pCos[i] < 0 || Abc_Lit2Var(pCos[i]) > nCis + nAnds )
+            return 0;
+    return 1;
+}
+
+// checks that the literal refers to an existing object other than a CO
+static int abc2java_GiaLitValid( Gia_Man_t * p, int Lit )
+{
+    return Lit >= 0 && Abc_Lit2Var(Lit) < Gia_ManObjNum(p) && !Gia_ObjIsCo(Gia_ManObj(p, Abc_Lit2Var(Lit)));
+}
+
+static Gia_Man_t * abc2java_GiaFromArrays( int nCis, int nRegs, const jint * pAnds, int nAnds, const jint * pCos, int nCos )
+{
+    Gia_Man_t * p;
+    int * pMap, i;
+
+    p = Gia_ManStart( 1 + nCis + nAnds + nCos );
+    Gia_ManHashAlloc( p );
+    pMap = ABC_ALLOC( int, 1 + nCis + nAnds );
+    pMap[0] = 0;
+    for ( i = 0; i < nCis; i++ )
+        pMap[1 + i] = Gia_ManAppendCi( p );
+    for ( i = 0; i < nAnds; i++ )
+        pMap[1 + nCis + i] = Gia_ManHashAnd( p, Abc_LitNotCond(pMap[Abc_Lit2Var(pAnds[2*i])], Abc_LitIsCompl(pAnds[2*i])),
+                                                Abc_LitNotCond(pMap[Abc_Lit2Var(pAnds[2*i+1])], Abc_LitIsCompl(pAnds[2*i+1])) );
+    for ( i = 0; i < nCos; i++ )
+        Gia_ManAppendCo( p, Abc_LitNotCond(pMap[Abc_Lit2Var(pCos[i])], Abc_LitIsCompl(pCos[i])) );
+    Gia_ManSetRegNum( p, nRegs );
+    ABC_FREE( pMap );
+    return p;
+}
+
+/*
+ * { nCis, nRegs, nAnds, nCos, ands..., cos... }, dangling nodes included.
+ */
+static Vec_Int_t * abc2java_GiaToArrays( Gia_Man_t * p )
+{
+    Vec_Int_t * vArrays;
+    Gia_Obj_t * pObj;
+    int i, iVar;
+
+    vArrays = Vec_IntAlloc( 4 + 2 * Gia_ManAndNum(p) + Gia_ManCoNum(p) );
+    Vec_IntPush( vArrays, Gia_ManCiNum(p) );
+    Vec_IntPush( vArrays, Gia_ManRegNum(p) );
+    Vec_IntPush( vArrays, Gia_ManAndNum(p) );
+    Vec_IntPush( vArrays, Gia_ManCoNum(p) );
+    // CIs may be interleaved with the nodes, so everything is renumbered
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Abc_Var2Lit( 1 + i, 0 );
+    iVar = 1 + Gia_ManCiNum(p);
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Vec_IntPush( vArrays, Gia_ObjFanin0Copy(pObj) );
+        Vec_IntPush( vArrays, Gia_ObjFanin1Copy(pObj) );
+        pObj->Value = Abc_Var2Lit( iVar++, 0 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntPush( vArrays, Gia_ObjFanin0Copy(pObj) );
+    return vArrays;
+}
+
+#ifndef ABC2JAVA_LEAN
+/*
+ * Latches become registers, with the PIs and POs first among the CIs and
+ * COs, as for the sequential engines; the network itself is not reordered.
+ */
+static Gia_Man_t * abc2java_GiaFromNtk( Abc_Ntk_t * pNtk )
+{
+    Aig_Man_t * pMan;
+    Gia_Man_t * p;
+
+    pMan = abc2java_NtkToSeqAig( pNtk );
+    p = Gia_ManFromAig( pMan );
+    Aig_ManStop( pMan );
+    return abc2java_GiaHashed( p );
+}
+
+static Abc_Ntk_t * abc2java_GiaToNtk( Gia_Man_t * p )
+{
+    Aig_Man_t * pMan;
+    Abc_Ntk_t * pNtk;
+
+    pMan = Gia_ManToAig( p, 0 );
+    pNtk = Abc_NtkFromAigPhase( pMan );
+    Aig_ManStop( pMan );
+    return pNtk;
+}
+#endif
+
+// &fraig
+static Gia_Man_t * abc2java_GiaFraig( Gia_Man_t * p, int nConfLimit )
+{
+    Cec_ParFra_t Pars;
+    Cec_ManFraSetDefaultParams( &Pars );
+    Pars.nBTLimit = nConfLimit;
+    return abc2java_GiaHashed( Cec_ManSatSweeping( p, &Pars, 1 ) );
+}
+
+// &scorr
+static Gia_Man_t * abc2java_GiaScorr( Gia_Man_t * p, int nConfLimit )
+{
+    Cec_ParCor_t Pars;
+    Cec_ManCorSetDefaultParams( &Pars );
+    Pars.nBTLimit = nConfLimit;
+    return abc2java_GiaHashed( Cec_ManLSCorrespondence( p, &Pars ) );
+}
+
+// &dch; the choices are dropped when converting back to a network
+static Gia_Man_t * abc2java_GiaDch( Gia_Man_t * p, int nConfLimit )
+{
+    Dch_Pars_t Pars;
+    Dch_ManSetDefaultParams( &Pars );
+    Pars.nBTLimit = nConfLimit;
+    return abc2java_GiaHashed( Gia_ManPerformDch( p, &Pars ) );
+}
+
+/*
+ * &cec: 1 if the two managers are equivalent output by output, 0 if not,
+ * -1 if undecided within the limits.
+ */
+static int abc2java_GiaCec( Gia_Man_t * pA, Gia_Man_t * pB, int nConfLimit, int nTimeLimit )
+{
+    Cec_ParCec_t Pars;
+    Gia_Man_t * pMiter;
+    int RetValue;
+
+    Cec_ManCecSetDefaultParams( &Pars );
+    Pars.nBTLimit = nConfLimit;
+    Pars.nTimeLimit = nTimeLimit;
+    Pars.fSilent = 1;
+    pMiter = Gia_ManMiter( pA, pB, 0, 0, 0, 0, 0 );
+    RetValue = Cec_ManVerify( pMiter, &Pars );
+    Gia_ManStop( pMiter );
+    return RetValue;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManStart
+  (JNIEnv *env, jclass, jint nObjsAlloc) {
+    ABC2JAVA_TRACE_CALL();
+    jlong result = 0;
+
+    try {
+        Gia_Man_t *p = Gia_ManStart( Abc_MaxInt(nObjsAlloc, 16) );
+        Gia_ManHashAlloc( p );
+        result = reinterpret_cast<jlong>(p);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Gia_1ManStop
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_ManStop( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManAppendCi
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = Gia_ManAppendCi( reinterpret_cast<Gia_Man_t *>(gAig) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManAppendCo
+  (JNIEnv *env, jclass, jlong gAig, jint lit) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jint result = 0;
+
+    if (!abc2java_GiaLitValid(p, lit)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = Gia_ManAppendCo( p, lit );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManHashAnd
+  (JNIEnv *env, jclass, jlong gAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jint result = 0;
+
+    if (!abc2java_GiaLitValid(p, litA) || !abc2java_GiaLitValid(p, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = Gia_ManHashAnd( p, litA, litB );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManHashOr
+  (JNIEnv *env, jclass, jlong gAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jint result = 0;
+
+    if (!abc2java_GiaLitValid(p, litA) || !abc2java_GiaLitValid(p, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = Gia_ManHashOr( p, litA, litB );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManHashXor
+  (JNIEnv *env, jclass, jlong gAig, jint litA, jint litB) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jint result = 0;
+
+    if (!abc2java_GiaLitValid(p, litA) || !abc2java_GiaLitValid(p, litB)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = Gia_ManHashXor( p, litA, litB );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManHashMux
+  (JNIEnv *env, jclass, jlong gAig, jint litC, jint litT, jint litE) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jint result = 0;
+
+    if (!abc2java_GiaLitValid(p, litC) || !abc2java_GiaLitValid(p, litT) || !abc2java_GiaLitValid(p, litE)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = Gia_ManHashMux( p, litC, litT, litE );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManCiNum
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Gia_ManCiNum( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManCoNum
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Gia_ManCoNum( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManAndNum
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Gia_ManAndNum( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManRegNum
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Gia_ManRegNum( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Gia_1ManSetRegNum
+  (JNIEnv *env, jclass, jlong gAig, jint nRegs) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+
+    if (nRegs < 0 || nRegs > Gia_ManCiNum(p) || nRegs > Gia_ManCoNum(p)) {
+        standard_exception(env);
+        return;
+    }
+    Gia_ManSetRegNum( p, nRegs );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManLevelNum
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = 0;
+
+    try {
+        result = Gia_ManLevelNum( reinterpret_cast<Gia_Man_t *>(gAig) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManMemory
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_CALL();
+    return (jlong)Gia_ManMemory( reinterpret_cast<Gia_Man_t *>(gAig) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManCoDriver
+  (JNIEnv *env, jclass, jlong gAig, jint i) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+
+    if (i < 0 || i >= Gia_ManCoNum(p)) {
+        standard_exception(env);
+        return 0;
+    }
+    return Gia_ObjFaninLit0p( p, Gia_ManCo(p, i) );
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManFromArrays
+  (JNIEnv *env, jclass, jint nCis, jint nRegs, jintArray ands, jintArray cos) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+    int nAnds = env->GetArrayLength(ands) / 2, nCos = env->GetArrayLength(cos);
+    jint *pAnds = env->GetIntArrayElements(ands, NULL);
+    jint *pCos = env->GetIntArrayElements(cos, NULL);
+
+    if (pAnds == NULL || pCos == NULL) {
+        out_of_mem_exception(env);
+    } else if (env->GetArrayLength(ands) % 2 != 0 || !abc2java_GiaArraysValid( nCis, nRegs, pAnds, nAnds, pCos, nCos )) {
+        standard_exception(env);
+    } else {
+        try {
+            result = reinterpret_cast<jlong>(abc2java_GiaFromArrays( nCis, nRegs, pAnds, nAnds, pCos, nCos ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pCos != NULL) env->ReleaseIntArrayElements(cos, pCos, JNI_ABORT);
+    if (pAnds != NULL) env->ReleaseIntArrayElements(ands, pAnds, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Gia_1ManToArrays
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_TIMED();
+    jintArray result = NULL;
+
+    try {
+        result = convertToIntArray( env, abc2java_GiaToArrays( reinterpret_cast<Gia_Man_t *>(gAig) ) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+#ifndef ABC2JAVA_LEAN
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManFromNtk
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || abc2java_NtkHasDcInits(pNtk)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaFromNtk( pNtk ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManToNtk
+  (JNIEnv *env, jclass, jlong gAig) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaToNtk( reinterpret_cast<Gia_Man_t *>(gAig) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManFraig
+  (JNIEnv *env, jclass, jlong gAig, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaFraig( reinterpret_cast<Gia_Man_t *>(gAig), nConfLimit ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManScorr
+  (JNIEnv *env, jclass, jlong gAig, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    Gia_Man_t *p = reinterpret_cast<Gia_Man_t *>(gAig);
+    jlong result = 0;
+
+    if (Gia_ManRegNum(p) == 0) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaScorr( p, nConfLimit ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Gia_1ManDch
+  (JNIEnv *env, jclass, jlong gAig, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaDch( reinterpret_cast<Gia_Man_t *>(gAig), nConfLimit ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Gia_1ManCec
+  (JNIEnv *env, jclass, jlong gAigA, jlong gAigB, jint nConfLimit, jint nTimeLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    Gia_Man_t *pA = reinterpret_cast<Gia_Man_t *>(gAigA);
+    Gia_Man_t *pB = reinterpret_cast<Gia_Man_t *>(gAigB);
+    jint result = -1;
+
+    if (Gia_ManCiNum(pA) != Gia_ManCiNum(pB) || Gia_ManCoNum(pA) != Gia_ManCoNum(pB)) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        result = abc2java_GiaCec( pA, pB, nConfLimit, nTimeLimit );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+
+//////////////////////////////////////
+// CHECKPOINTS
+//////////////////////////////////////
+
+/*
+ * Speculative queries on one Ivy manager: a checkpoint is the object id
+ * bound at the time it was taken, and rolling back deletes every object
+ * created since then (nodes, PIs and POs), so the cost is proportional to
+ * the objects added, not to the base design. Ivy never reuses ids, so
+ * the objects of the overlay are exactly those with ids past the
+ * checkpoint; they are deleted newest first, which removes the fanouts of
+ * a node before the node itself and restores the reference counts and the
+ * hash table of the base. Checkpoints nest like a stack.
+ *
+ * Ivy_FraigPerform does not change the AIG of its input, so it can run on
+ * the manager between a checkpoint and its rollback.
+ */
+static void abc2java_IvyRollback( Ivy_Man_t * p, int nObjsOld )
+{
+    Ivy_Obj_t * pObj;
+    int i;
+
+    for ( i = Vec_PtrSize(p->vObjs) - 1; i >= nObjsOld; i-- )
+        if ( (pObj = Ivy_ManObj(p, i)) )
+            Ivy_ObjDelete( p, pObj, 1 );
+    Vec_PtrShrink( p->vObjs, nObjsOld );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManCheckpoint
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Vec_PtrSize( reinterpret_cast<Ivy_Man_t *>(fAig)->vObjs );
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManRollback
+  (JNIEnv *env, jclass, jlong fAig, jint checkpoint) {
+    ABC2JAVA_TRACE_CALL();
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+
+    // the constant is object 0 and always stays
+    if (checkpoint < 1 || checkpoint > Vec_PtrSize(fMan->vObjs)) {
+        standard_exception(env);
+        return;
+    }
+    try {
+        abc2java_IvyRollback( fMan, checkpoint );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+}
+
+
+//////////////////////////////////////
+// ALL SOLUTIONS
+//////////////////////////////////////
+
+/*
+ * Enumerates the PI assignments under which a node is 1, with one
+ * incremental SAT solver per enumeration. The Tseitin clauses of the
+ * node's cone are added once; every solution found is blocked by a
+ * clause, so a Next call continues where the previous one stopped.
+ *
+ * Solver variable 0 is the constant 1; the other variables are the cone
+ * objects in topological order. In cube mode, a solution is lifted
+ * to the PIs that justify the node: an AND at 1 needs both fanins, an AND
+ * at 0 one fanin at 0 (preferably one that is already needed), an XOR
+ * both. Every completion of such a cube satisfies the node, and blocking
+ * the cube removes all of them at once.
+ *
+ * Records are bit-vectors over all PIs of the manager (PI i in bit i % 64
+ * of word i / 64), followed by the care mask: the PIs of the cube, or in
+ * full mode the PIs of the cone. A full model is thus a model of the
+ * cone; the PIs outside it are free and are not enumerated.
+ */
+#define ABC2JAVA_ALLSAT_CONST   0
+#define ABC2JAVA_ALLSAT_PI      1
+#define ABC2JAVA_ALLSAT_AND     2
+#define ABC2JAVA_ALLSAT_XOR     3
+
+typedef struct abc2java_AllSat_t_
+{
+    sat_solver *     pSat;
+    int              fCubes;
+    int              fDone;
+    int              nWords;     // words per bit-vector
+    int              RootLit;
+    Vec_Int_t *      vType;      // per solver variable
+    Vec_Int_t *      vPiNum;     // PI index of PI variables, -1 otherwise
+    Vec_Int_t *      vFan0;      // fanin literals of node variables
+    Vec_Int_t *      vFan1;
+    Vec_Int_t *      vLits;      // blocking clause
+    Vec_Str_t *      vReq;       // variables needed by the lifted cube
+} abc2java_AllSat_t;
+
+static abc2java_AllSat_t * abc2java_AllSatAlloc( int nPis, int fCubes )
+{
+    abc2java_AllSat_t * p = ABC_CALLOC( abc2java_AllSat_t, 1 );
+    p->fCubes = fCubes;
+    p->nWords = Abc_MaxInt( 1, (nPis + 63) / 64 );
+    p->vType  = Vec_IntAlloc( 1000 );
+    p->vPiNum = Vec_IntAlloc( 1000 );
+    p->vFan0  = Vec_IntAlloc( 1000 );
+    p->vFan1  = Vec_IntAlloc( 1000 );
+    p->vLits  = Vec_IntAlloc( 100 );
+    p->vReq   = Vec_StrAlloc( 1000 );
+    // variable 0 is the constant
+    Vec_IntPush( p->vType, ABC2JAVA_ALLSAT_CONST );
+    Vec_IntPush( p->vPiNum, -1 );
+    Vec_IntPush( p->vFan0, -1 );
+    Vec_IntPush( p->vFan1, -1 );
+    return p;
+}
+
+static void abc2java_AllSatFree( abc2java_AllSat_t * p )
+{
+    if ( p->pSat )
+        sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vType );
+    Vec_IntFree( p->vPiNum );
+    Vec_IntFree( p->vFan0 );
+    Vec_IntFree( p->vFan1 );
+    Vec_IntFree( p->vLits );
+    Vec_StrFree( p->vReq );
+    ABC_FREE( p );
+}
+
+// returns the positive literal of a new variable
+static int abc2java_AllSatAddVar( abc2java_AllSat_t * p, int Type, int iPi, int Lit0, int Lit1 )
+{
+    Vec_IntPush( p->vType, Type );
+    Vec_IntPush( p->vPiNum, iPi );
+    Vec_IntPush( p->vFan0, Lit0 );
+    Vec_IntPush( p->vFan1, Lit1 );
+    return toLitCond( Vec_IntSize(p->vType) - 1, 0 );
+}
+
+static int abc2java_AllSatClause( sat_solver * pSat, int Lit0, int Lit1, int Lit2 )
+{
+    lit Lits[3] = { Lit0, Lit1, Lit2 };
+    return sat_solver_addclause( pSat, Lits, Lits + (Lit2 < 0 ? 2 : 3) );
+}
+
+/*
+ * Creates the solver once the cone is collected and asserts the root.
+ */
+static void abc2java_AllSatStartSolver( abc2java_AllSat_t * p, int RootLit )
+{
+    int v, nVars = Vec_IntSize(p->vType), Lit0, Lit1, Lit;
+    int fOk = 1;
+
+    p->RootLit = RootLit;
+    p->pSat = sat_solver_new();
+    sat_solver_setnvars( p->pSat, nVars );
+    Lit = toLitCond( 0, 0 );
+    fOk &= sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    for ( v = 1; v < nVars; v++ )
+    {
+        Lit  = toLitCond( v, 0 );
+        Lit0 = Vec_IntEntry( p->vFan0, v );
+        Lit1 = Vec_IntEntry( p->vFan1, v );
+        if ( Vec_IntEntry(p->vType, v) == ABC2JAVA_ALLSAT_AND )
+        {
+            fOk &= abc2java_AllSatClause( p->pSat, Abc_LitNot(Lit), Lit0, -1 );
+            fOk &= abc2java_AllSatClause( p->pSat, Abc_LitNot(Lit), Lit1, -1 );
+            fOk &= abc2java_AllSatClause( p->pSat, Lit, Abc_LitNot(Lit0), Abc_LitNot(Lit1) );
+        }
+        else if ( Vec_IntEntry(p->vType, v) == ABC2JAVA_ALLSAT_XOR )
+        {
+            fOk &= abc2java_AllSatClause( p->pSat, Abc_LitNot(Lit), Lit0, Lit1 );
+            fOk &= abc2java_AllSatClause( p->pSat, Abc_LitNot(Lit), Abc_LitNot(Lit0), Abc_LitNot(Lit1) );
+            fOk &= abc2java_AllSatClause( p->pSat, Lit, Abc_LitNot(Lit0), Lit1 );
+            fOk &= abc2java_AllSatClause( p->pSat, Lit, Lit0, Abc_LitNot(Lit1) );
+        }
+    }
+    fOk &= sat_solver_addclause( p->pSat, &RootLit, &RootLit + 1 );
+    p->fDone = !fOk;
+    Vec_StrFill( p->vReq, nVars, 0 );
+}
+
+static inline int abc2java_AllSatLitValue( abc2java_AllSat_t * p, int Lit )
+{
+    return sat_solver_var_value( p->pSat, Abc_Lit2Var(Lit) ) ^ Abc_LitIsCompl(Lit);
+}
+
+/*
+ * Writes the current model (or its lifted cube) and collects the blocking
+ * clause in vLits.
+ */
+static void abc2java_AllSatRecord( abc2java_AllSat_t * p, word * pVals, word * pCare )
+{
+    char * pReq = Vec_StrArray( p->vReq );
+    int v, iPi, Value, Lit0, Lit1;
+
+    Vec_IntClear( p->vLits );
+    if ( p->fCubes )
+        pReq[Abc_Lit2Var(p->RootLit)] = 1;
+    for ( v = Vec_IntSize(p->vType) - 1; v > 0; v-- )
+    {
+        if ( p->fCubes && !pReq[v] )
+            continue;
+        pReq[v] = 0;
+        Value = sat_solver_var_value( p->pSat, v );
+        if ( Vec_IntEntry(p->vType, v) == ABC2JAVA_ALLSAT_PI )
+        {
+            iPi = Vec_IntEntry( p->vPiNum, v );
+            if ( Value )
+                pVals[iPi >> 6] |= (word)1 << (iPi & 63);
+            pCare[iPi >> 6] |= (word)1 << (iPi & 63);
+            Vec_IntPush( p->vLits, toLitCond(v, Value) );
+            continue;
+        }
+        if ( !p->fCubes )
+            continue;
+        Lit0 = Vec_IntEntry( p->vFan0, v );
+        Lit1 = Vec_IntEntry( p->vFan1, v );
+        if ( Value || Vec_IntEntry(p->vType, v) == ABC2JAVA_ALLSAT_XOR )
+        {
+            pReq[Abc_Lit2Var(Lit0)] = 1;
+            pReq[Abc_Lit2Var(Lit1)] = 1;
+        }
+        else if ( !abc2java_AllSatLitValue(p, Lit0) && (abc2java_AllSatLitValue(p, Lit1) || pReq[Abc_Lit2Var(Lit0)]) )
+            pReq[Abc_Lit2Var(Lit0)] = 1;
+        else
+            pReq[Abc_Lit2Var(Lit1)] = 1;
+    }
+    pReq[0] = 0;
+}
+
+/*
+ * Writes up to nMax records to pOut. Stops early when a solve call runs
+ * out of conflicts; the next call retries it.
+ */
+static int abc2java_AllSatNext( abc2java_AllSat_t * p, word * pOut, int nMax, int nConfLimit )
+{
+    int nRecWords = 2 * p->nWords;
+    int RetValue, nFound = 0;
+    word * pRec;
+
+    while ( !p->fDone && nFound < nMax )
+    {
+        RetValue = sat_solver_solve( p->pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+        if ( RetValue == l_Undef )
+            break;
+        if ( RetValue == l_False )
+        {
+            p->fDone = 1;
+            break;
+        }
+        pRec = pOut + (size_t)nFound++ * nRecWords;
+        memset( pRec, 0, sizeof(word) * nRecWords );
+        abc2java_AllSatRecord( p, pRec, pRec + p->nWords );
+        // an empty blocking clause means the node is constant 1 on the cone
+        if ( Vec_IntSize(p->vLits) == 0 || !sat_solver_addclause(p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits)) )
+            p->fDone = 1;
+    }
+    return nFound;
+}
+
+/*
+ * Collects the cone of a Fraig node, iteratively; pMap is indexed by the
+ * node numbers. Returns the solver literal of the root.
+ */
+static int abc2java_FraigAllSatCone( abc2java_AllSat_t * p, Fraig_Man_t * fMan, Fraig_Node_t * pRoot )
+{
+    Fraig_Node_t * pNode, * pFan0, * pFan1;
+    Vec_Ptr_t * vStack;
+    int * pMap, * pPiNum, i, RootLit;
+
+    pMap = ABC_FALLOC( int, fMan->vNodes->nSize );
+    pPiNum = ABC_FALLOC( int, fMan->vNodes->nSize );
+    for ( i = 0; i < fMan->vInputs->nSize; i++ )
+        pPiNum[fMan->vInputs->pArray[i]->Num] = i;
+    pMap[fMan->pConst1->Num] = toLitCond( 0, 0 );
+
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Fraig_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pNode = (Fraig_Node_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pNode->Num] >= 0 )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pPiNum[pNode->Num] >= 0 )
+        {
+            pMap[pNode->Num] = abc2java_AllSatAddVar( p, ABC2JAVA_ALLSAT_PI, pPiNum[pNode->Num], -1, -1 );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pFan0 = Fraig_Regular(pNode->p1);
+        pFan1 = Fraig_Regular(pNode->p2);
+        if ( pMap[pFan0->Num] >= 0 && pMap[pFan1->Num] >= 0 )
+        {
+            pMap[pNode->Num] = abc2java_AllSatAddVar( p, ABC2JAVA_ALLSAT_AND, -1,
+                                                      Abc_LitNotCond(pMap[pFan0->Num], Fraig_IsComplement(pNode->p1)),
+                                                      Abc_LitNotCond(pMap[pFan1->Num], Fraig_IsComplement(pNode->p2)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pMap[pFan0->Num] < 0 )
+            Vec_PtrPush( vStack, pFan0 );
+        if ( pMap[pFan1->Num] < 0 )
+            Vec_PtrPush( vStack, pFan1 );
+    }
+    Vec_PtrFree( vStack );
+    RootLit = Abc_LitNotCond( pMap[Fraig_Regular(pRoot)->Num], Fraig_IsComplement(pRoot) );
+    ABC_FREE( pPiNum );
+    ABC_FREE( pMap );
+    return RootLit;
+}
+
+/*
+ * Same for Ivy, with pMap indexed by object ids; buffers take the literal
+ * of their fanin.
+ */
+static int abc2java_IvyAllSatCone( abc2java_AllSat_t * p, Ivy_Man_t * pMan, Ivy_Obj_t * pRoot )
+{
+    Ivy_Obj_t * pObj, * pFan0, * pFan1;
+    Vec_Ptr_t * vStack;
+    int * pMap, * pPiNum, i, Lit0, RootLit;
+
+    pMap = ABC_FALLOC( int, Ivy_ManObjIdMax(pMan) + 1 );
+    pPiNum = ABC_FALLOC( int, Ivy_ManObjIdMax(pMan) + 1 );
+    Ivy_ManForEachPi( pMan, pObj, i )
+        pPiNum[pObj->Id] = i;
+    pMap[Ivy_ManConst1(pMan)->Id] = toLitCond( 0, 0 );
+
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Ivy_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pObj = (Ivy_Obj_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pObj->Id] >= 0 )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pPiNum[pObj->Id] >= 0 )
+        {
+            pMap[pObj->Id] = abc2java_AllSatAddVar( p, ABC2JAVA_ALLSAT_PI, pPiNum[pObj->Id], -1, -1 );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pFan0 = Ivy_ObjFanin0(pObj);
+        pFan1 = Ivy_ObjIsBuf(pObj) ? pFan0 : Ivy_ObjFanin1(pObj);
+        if ( pMap[pFan0->Id] >= 0 && pMap[pFan1->Id] >= 0 )
+        {
+            Lit0 = Abc_LitNotCond( pMap[pFan0->Id], Ivy_ObjFaninC0(pObj) );
+            if ( Ivy_ObjIsBuf(pObj) )
+                pMap[pObj->Id] = Lit0;
+            else
+                pMap[pObj->Id] = abc2java_AllSatAddVar( p, Ivy_ObjIsExor(pObj) ? ABC2JAVA_ALLSAT_XOR : ABC2JAVA_ALLSAT_AND, -1,
+                                                        Lit0, Abc_LitNotCond(pMap[pFan1->Id], Ivy_ObjFaninC1(pObj)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pMap[pFan0->Id] < 0 )
+            Vec_PtrPush( vStack, pFan0 );
+        if ( pMap[pFan1->Id] < 0 )
+            Vec_PtrPush( vStack, pFan1 );
+    }
+    Vec_PtrFree( vStack );
+    RootLit = Abc_LitNotCond( pMap[Ivy_Regular(pRoot)->Id], Ivy_IsComplement(pRoot) );
+    ABC_FREE( pPiNum );
+    ABC_FREE( pMap );
+    return RootLit;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1AllSatStart
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jboolean fCubes) {
+    ABC2JAVA_TRACE_TIMED();
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+    jlong result = 0;
+
+    try {
+        abc2java_AllSat_t *p = abc2java_AllSatAlloc( fMan->vInputs->nSize, fCubes );
+        abc2java_AllSatStartSolver( p, abc2java_FraigAllSatCone( p, fMan, reinterpret_cast<Fraig_Node_t *>(fObj) ) );
+        result = reinterpret_cast<jlong>(p);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1AllSatStart
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jboolean fCubes) {
+    ABC2JAVA_TRACE_TIMED();
+    Ivy_Man_t *fMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+    jlong result = 0;
+
+    try {
+        abc2java_AllSat_t *p = abc2java_AllSatAlloc( Ivy_ManPiNum(fMan), fCubes );
+        abc2java_AllSatStartSolver( p, abc2java_IvyAllSatCone( p, fMan, reinterpret_cast<Ivy_Obj_t *>(fObj) ) );
+        result = reinterpret_cast<jlong>(p);
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1AllSatRecordBytes
+  (JNIEnv *env, jclass, jlong pEnum) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_AllSat_t *p = reinterpret_cast<abc2java_AllSat_t *>(pEnum);
+    return (jint)sizeof(word) * 2 * p->nWords;
+}
+
+/*
+ * Returns the number of records written (at most nMax, and at most what
+ * fits in buf), or -1 if buf is not a direct buffer.
+ */
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1AllSatNext
+  (JNIEnv *env, jclass, jlong pEnum, jobject buf, jint nMax, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    abc2java_AllSat_t *p = reinterpret_cast<abc2java_AllSat_t *>(pEnum);
+    word *pOut = reinterpret_cast<word *>(env->GetDirectBufferAddress(buf));
+    jlong nRecBytes = (jlong)sizeof(word) * 2 * p->nWords;
+    jint result = 0;
+
+    if (pOut == NULL) {
+        return -1;
+    }
+    nMax = (jint)std::min( (jlong)nMax, env->GetDirectBufferCapacity(buf) / nRecBytes );
+    try {
+        result = abc2java_AllSatNext( p, pOut, nMax, nConfLimit );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1AllSatIsDone
+  (JNIEnv *env, jclass, jlong pEnum) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<abc2java_AllSat_t *>(pEnum)->fDone;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1AllSatStop
+  (JNIEnv *env, jclass, jlong pEnum) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_AllSatFree( reinterpret_cast<abc2java_AllSat_t *>(pEnum) );
+}
+
+
+//////////////////////////////////////
+// CUTS
+//////////////////////////////////////
+
+/*
+ * Priority cuts with truth tables for every AND node of a network or an
+ * Ivy manager. The AIG is first copied into flat fanin arrays indexed by
+ * object id. Nodes are then processed level by level: the nodes of one
+ * level only read the cuts of lower levels, so they are split among the
+ * threads, which meet at a barrier before the next level.
+ *
+ * A node keeps at most nCutsMax cuts of at most nLeavesMax (<= 8) leaves,
+ * preferring small ones and dropping dominated ones. The trivial cut is
+ * implied and not stored. Truth tables are over nLeavesMax variables,
+ * leaf i being variable i; they are computed from the fanin cuts with the
+ * word-level operations of utilTruth.h, which the compiler vectorizes.
+ * CIs and the constant are leaves.
+ */
+#define ABC2JAVA_CUT_LEAVES_MAX 8
+#define ABC2JAVA_CUT_CUTS_MAX   64
+
+typedef struct abc2java_Cuts_t_
+{
+    int          nObjs;
+    int          nLeavesMax;
+    int          nCutsMax;
+    int          nWords;         // truth table words per cut
+    int *        pFan0;          // fanin literals of the nodes, -1 for leaves
+    int *        pFan1;
+    char *       pXor;           // Ivy EXOR nodes
+    Vec_Int_t *  vOrder;         // nodes sorted by level
+    Vec_Int_t *  vLevels;        // start of each level in vOrder
+    int *        pSlot0;         // first cut slot of each node
+    int *        pNum;           // cuts of each node
+    int *        pSizes;         // per cut slot
+    int *        pLeaves;        // nLeavesMax per slot
+    word *       pTruths;        // nWords per slot
+    // threads
+    pthread_mutex_t Mutex;
+    pthread_cond_t  Cond;
+    int          nThreads;
+    int          fGo;
+    int          nWaiting;
+    int          Phase;
+    int *        pCpus;          // placement (see THREAD PLACEMENT)
+    int          nCpus;
+    int *        pPlacement;     // ABC2JAVA_PLACE_INTS per thread that ran
+} abc2java_Cuts_t;
+
+typedef struct abc2java_CutsTemp_t_
+{
+    abc2java_Cuts_t * p;
+    int          iThread;
+    int          nCands;
+    int *        pSizes;         // nCutsMax + 1 candidates
+    int *        pLeaves;
+    int *        pSrc;           // fanin cut slots of a candidate, -1 for trivial
+    word *       pTruth0;
+    word *       pTruth1;
+} abc2java_CutsTemp_t;
+
+static abc2java_Cuts_t * abc2java_CutsAlloc( int nObjs, int nLeavesMax, int nCutsMax )
+{
+    abc2java_Cuts_t * p = ABC_CALLOC( abc2java_Cuts_t, 1 );
+    p->nObjs      = nObjs;
+    p->nLeavesMax = nLeavesMax;
+    p->nCutsMax   = nCutsMax;
+    p->nWords     = Abc_TtWordNum( nLeavesMax );
+    p->pFan0      = ABC_FALLOC( int, nObjs );
+    p->pFan1      = ABC_FALLOC( int, nObjs );
+    p->pXor       = ABC_CALLOC( char, nObjs );
+    p->pSlot0     = ABC_FALLOC( int, nObjs );
+    p->pNum       = ABC_CALLOC( int, nObjs );
+    return p;
+}
+
+static void abc2java_CutsFree( abc2java_Cuts_t * p )
+{
+    if ( p->vOrder )
+        Vec_IntFree( p->vOrder );
+    if ( p->vLevels )
+        Vec_IntFree( p->vLevels );
+    ABC_FREE( p->pFan0 );
+    ABC_FREE( p->pFan1 );
+    ABC_FREE( p->pXor );
+    ABC_FREE( p->pSlot0 );
+    ABC_FREE( p->pNum );
+    ABC_FREE( p->pSizes );
+    ABC_FREE( p->pLeaves );
+    ABC_FREE( p->pTruths );
+    ABC_FREE( p->pCpus );
+    ABC_FREE( p->pPlacement );
+    ABC_FREE( p );
+}
+
+/*
+ * Sorts the nodes by level (iteratively, ids need not be topological)
+ * and assigns their cut slots.
+ */
+static void abc2java_CutsLevelize( abc2java_Cuts_t * p )
+{
+    Vec_Int_t * vStack;
+    int * pLevel, * pCount;
+    int i, Id, Fan0, Fan1, nLevels = 1, nSlots = 0;
+
+    pLevel = ABC_FALLOC( int, p->nObjs );
+    for ( i = 0; i < p->nObjs; i++ )
+        if ( p->pFan0[i] < 0 )
+            pLevel[i] = 0;
+    vStack = Vec_IntAlloc( 100 );
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        if ( pLevel[i] >= 0 )
+            continue;
+        Vec_IntPush( vStack, i );
+        while ( Vec_IntSize(vStack) > 0 )
+        {
+            Id = Vec_IntEntryLast( vStack );
+            Fan0 = Abc_Lit2Var( p->pFan0[Id] );
+            Fan1 = Abc_Lit2Var( p->pFan1[Id] );
+            if ( pLevel[Id] >= 0 )
+                Vec_IntPop( vStack );
+            else if ( pLevel[Fan0] >= 0 && pLevel[Fan1] >= 0 )
+            {
+                pLevel[Id] = 1 + Abc_MaxInt( pLevel[Fan0], pLevel[Fan1] );
+                nLevels = Abc_MaxInt( nLevels, pLevel[Id] + 1 );
+                Vec_IntPop( vStack );
+            }
+            else
+            {
+                if ( pLevel[Fan0] < 0 )
+                    Vec_IntPush( vStack, Fan0 );
+                if ( pLevel[Fan1] < 0 )
+                    Vec_IntPush( vStack, Fan1 );
+            }
+        }
+    }
+    Vec_IntFree( vStack );
+
+    // counting sort of the nodes by level
+    pCount = ABC_CALLOC( int, nLevels + 1 );
+    for ( i = 0; i < p->nObjs; i++ )
+        if ( p->pFan0[i] >= 0 )
+            pCount[pLevel[i] + 1]++;
+    for ( i = 1; i <= nLevels; i++ )
+        pCount[i] += pCount[i - 1];
+    p->vLevels = Vec_IntAlloc( nLevels + 1 );
+    for ( i = 0; i <= nLevels; i++ )
+        Vec_IntPush( p->vLevels, pCount[i] );
+    p->vOrder = Vec_IntStart( pCount[nLevels] );
+    for ( i = 0; i < p->nObjs; i++ )
+        if ( p->pFan0[i] >= 0 )
+            Vec_IntWriteEntry( p->vOrder, pCount[pLevel[i]]++, i );
+    ABC_FREE( pCount );
+    ABC_FREE( pLevel );
+
+    for ( i = 0; i < Vec_IntSize(p->vOrder); i++ )
+    {
+        p->pSlot0[Vec_IntEntry(p->vOrder, i)] = nSlots;
+        nSlots += p->nCutsMax;
+    }
+    p->pSizes  = ABC_CALLOC( int, nSlots );
+    p->pLeaves = ABC_ALLOC( int, (size_t)nSlots * p->nLeavesMax );
+    p->pTruths = ABC_ALLOC( word, (size_t)nSlots * p->nWords );
+}
+
+// merges two sorted leaf sets; returns the size, or -1 if too large
+static inline int abc2java_CutsMerge( int * pA, int nA, int * pB, int nB, int * pOut, int nMax )
+{
+    int i = 0, k = 0, n = 0;
+    while ( i < nA || k < nB )
+    {
+        if ( n == nMax )
+            return -1;
+        if ( k == nB || (i < nA && pA[i] < pB[k]) )
+            pOut[n++] = pA[i++];
+        else if ( i == nA || pB[k] < pA[i] )
+            pOut[n++] = pB[k++];
+        else
+            pOut[n++] = pA[i++], k++;
+    }
+    return n;
+}
+
+// sorted subset test
+static inline int abc2java_CutsContains( int * pBig, int nBig, int * pSmall, int nSmall )
+{
+    int i, k = 0;
+    if ( nSmall > nBig )
+        return 0;
+    for ( i = 0; i < nBig && k < nSmall; i++ )
+        if ( pBig[i] == pSmall[k] )
+            k++;
+        else if ( pBig[i] > pSmall[k] )
+            return 0;
+    return k == nSmall;
+}
+
+/*
+ * Adds a candidate unless dominated, removes the candidates it dominates,
+ * keeps the list sorted by size and at most nCutsMax long.
+ */
+static void abc2java_CutsAddCand( abc2java_CutsTemp_t * t, int * pLeaves, int nLeaves, int Src0, int Src1 )
+{
+    abc2java_Cuts_t * p = t->p;
+    int K = p->nLeavesMax, i, k, Pos;
+
+    if ( t->nCands == p->nCutsMax && nLeaves >= t->pSizes[t->nCands - 1] )
+        return;
+    for ( i = 0; i < t->nCands; i++ )
+        if ( abc2java_CutsContains( pLeaves, nLeaves, t->pLeaves + i * K, t->pSizes[i] ) )
+            return;
+    for ( i = k = 0; i < t->nCands; i++ )
+    {
+        if ( abc2java_CutsContains( t->pLeaves + i * K, t->pSizes[i], pLeaves, nLeaves ) )
+            continue;
+        if ( i != k )
+        {
+            t->pSizes[k] = t->pSizes[i];
+            memcpy( t->pLeaves + k * K, t->pLeaves + i * K, sizeof(int) * K );
+            t->pSrc[2*k] = t->pSrc[2*i];
+            t->pSrc[2*k+1] = t->pSrc[2*i+1];
+        }
+        k++;
+    }
+    t->nCands = k;
+    for ( Pos = t->nCands; Pos > 0 && t->pSizes[Pos - 1] > nLeaves; Pos-- )
+    {
+        t->pSizes[Pos] = t->pSizes[Pos - 1];
+        memcpy( t->pLeaves + Pos * K, t->pLeaves + (Pos - 1) * K, sizeof(int) * K );
+        t->pSrc[2*Pos] = t->pSrc[2*Pos-2];
+        t->pSrc[2*Pos+1] = t->pSrc[2*Pos-1];
+    }
+    t->pSizes[Pos] = nLeaves;
+    memcpy( t->pLeaves + Pos * K, pLeaves, sizeof(int) * nLeaves );
+    t->pSrc[2*Pos] = Src0;
+    t->pSrc[2*Pos+1] = Src1;
+    t->nCands = Abc_MinInt( t->nCands + 1, p->nCutsMax );
+}
+
+/*
+ * Truth table of a fanin over the leaves of a cut: the elementary variable
+ * of the fanin for its trivial cut, otherwise the truth table of its cut
+ * with the variables moved to the positions of their leaves.
+ */
+static void abc2java_CutsFaninTruth( abc2java_Cuts_t * p, int FanLit, int Src, int * pLeaves, int nLeaves, word * pTruth )
+{
+    int * pFrom, nFrom, i, k;
+
+    if ( Src < 0 )
+    {
+        for ( i = 0; pLeaves[i] != Abc_Lit2Var(FanLit); i++ );
+        Abc_TtIthVar( pTruth, i, p->nLeavesMax );
+    }
+    else
+    {
+        Abc_TtCopy( pTruth, p->pTruths + (size_t)Src * p->nWords, p->nWords, 0 );
+        pFrom = p->pLeaves + (size_t)Src * p->nLeavesMax;
+        nFrom = p->pSizes[Src];
+        for ( i = nLeaves - 1, k = nFrom - 1; k >= 0; i-- )
+        {
+            if ( pLeaves[i] != pFrom[k] )
+                continue;
+            if ( k < i )
+                Abc_TtSwapVars( pTruth, p->nLeavesMax, k, i );
+            k--;
+        }
+    }
+    if ( Abc_LitIsCompl(FanLit) )
+        Abc_TtCopy( pTruth, pTruth, p->nWords, 1 );
+}
+
+static void abc2java_CutsNode( abc2java_CutsTemp_t * t, int Id )
+{
+    abc2java_Cuts_t * p = t->p;
+    int K = p->nLeavesMax, pMerged[ABC2JAVA_CUT_LEAVES_MAX];
+    int Fan0 = Abc_Lit2Var(p->pFan0[Id]), Fan1 = Abc_Lit2Var(p->pFan1[Id]);
+    int i, k, Src0, Src1, nLeaves, Slot;
+
+    t->nCands = 0;
+    // index -1 is the trivial cut of the fanin
+    for ( i = -1; i < p->pNum[Fan0]; i++ )
+    for ( k = -1; k < p->pNum[Fan1]; k++ )
+    {
+        Src0 = i < 0 ? -1 : p->pSlot0[Fan0] + i;
+        Src1 = k < 0 ? -1 : p->pSlot0[Fan1] + k;
+        nLeaves = abc2java_CutsMerge( Src0 < 0 ? &Fan0 : p->pLeaves + (size_t)Src0 * K, Src0 < 0 ? 1 : p->pSizes[Src0],
+                                      Src1 < 0 ? &Fan1 : p->pLeaves + (size_t)Src1 * K, Src1 < 0 ? 1 : p->pSizes[Src1],
+                                      pMerged, K );
+        if ( nLeaves > 0 )
+            abc2java_CutsAddCand( t, pMerged, nLeaves, Src0, Src1 );
+    }
+    for ( i = 0; i < t->nCands; i++ )
+    {
+        Slot = p->pSlot0[Id] + i;
+        p->pSizes[Slot] = t->pSizes[i];
+        memcpy( p->pLeaves + (size_t)Slot * K, t->pLeaves + i * K, sizeof(int) * K );
+        abc2java_CutsFaninTruth( p, p->pFan0[Id], t->pSrc[2*i], t->pLeaves + i * K, t->pSizes[i], t->pTruth0 );
+        abc2java_CutsFaninTruth( p, p->pFan1[Id], t->pSrc[2*i+1], t->pLeaves + i * K, t->pSizes[i], t->pTruth1 );
+        if ( p->pXor[Id] )
+            Abc_TtXor( p->pTruths + (size_t)Slot * p->nWords, t->pTruth0, t->pTruth1, p->nWords, 0 );
+        else
+            Abc_TtAnd( p->pTruths + (size_t)Slot * p->nWords, t->pTruth0, t->pTruth1, p->nWords, 0 );
+    }
+    // published last: the next level reads pNum only after the barrier
+    p->pNum[Id] = t->nCands;
+}
+
+static void abc2java_CutsBarrier( abc2java_Cuts_t * p )
+{
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+}
+
+static void * abc2java_CutsWorker( void * pArg )
+{
+    abc2java_CutsTemp_t * t = (abc2java_CutsTemp_t *)pArg;
+    abc2java_Cuts_t * p = t->p;
+    int l, i, nCands = p->nCutsMax + 1;
+
+    // the scratch space is allocated after pinning, so it is node-local
+    abc2java_ThreadPlace( p->pCpus, p->nCpus, t->iThread, p->pPlacement + ABC2JAVA_PLACE_INTS * t->iThread );
+    t->pSizes  = ABC_ALLOC( int, nCands );
+    t->pLeaves = ABC_ALLOC( int, nCands * p->nLeavesMax );
+    t->pSrc    = ABC_ALLOC( int, 2 * nCands );
+    t->pTruth0 = ABC_ALLOC( word, p->nWords );
+    t->pTruth1 = ABC_ALLOC( word, p->nWords );
+    // the thread count is known once all threads were started
+    pthread_mutex_lock( &p->Mutex );
+    while ( !p->fGo )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( l = 1; l < Vec_IntSize(p->vLevels) - 1; l++ )
+    {
+        for ( i = Vec_IntEntry(p->vLevels, l) + t->iThread; i < Vec_IntEntry(p->vLevels, l + 1); i += p->nThreads )
+            abc2java_CutsNode( t, Vec_IntEntry(p->vOrder, i) );
+        if ( p->nThreads > 1 )
+            abc2java_CutsBarrier( p );
+    }
+    return NULL;
+}
+
+static void abc2java_CutsCompute( abc2java_Cuts_t * p, int nThreads )
+{
+    abc2java_CutsTemp_t * pTemps;
+    abc2java_Affinity_t Caller;
+    pthread_t * pThreads;
+    int i, nStarted;
+
+    abc2java_CutsLevelize( p );
+    nThreads = Abc_MaxInt( 1, nThreads );
+    pTemps = ABC_CALLOC( abc2java_CutsTemp_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pTemps[i].p       = p;
+        pTemps[i].iThread = i;
+    }
+    p->pCpus = abc2java_CpusRead( &p->nCpus );
+    p->pPlacement = ABC_FALLOC( int, ABC2JAVA_PLACE_INTS * nThreads );
+    abc2java_ThreadAffinitySave( &Caller );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    // the caller's thread is thread 0; if a thread fails to start,
+    // the remaining work is split among those that did
+    for ( nStarted = 1; nStarted < nThreads; nStarted++ )
+        if ( pthread_create( pThreads + nStarted, NULL, abc2java_CutsWorker, pTemps + nStarted ) != 0 )
+            break;
+    pthread_mutex_lock( &p->Mutex );
+    p->nThreads = nStarted;
+    p->fGo = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    abc2java_CutsWorker( pTemps );
+    for ( i = 1; i < nStarted; i++ )
+        pthread_join( pThreads[i], NULL );
+    if ( p->nCpus > 0 )
+        abc2java_ThreadAffinityRestore( &Caller );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ABC_FREE( pTemps[i].pSizes );
+        ABC_FREE( pTemps[i].pLeaves );
+        ABC_FREE( pTemps[i].pSrc );
+        ABC_FREE( pTemps[i].pTruth0 );
+        ABC_FREE( pTemps[i].pTruth1 );
+    }
+    ABC_FREE( pTemps );
+    ABC_FREE( pThreads );
+}
+
+static inline int abc2java_CutsValid( int nLeavesMax, int nCutsMax )
+{
+    return nLeavesMax >= 2 && nLeavesMax <= ABC2JAVA_CUT_LEAVES_MAX && nCutsMax >= 1 && nCutsMax <= ABC2JAVA_CUT_CUTS_MAX;
+}
+
+/*
+ * Record: { int node, int nLeaves, int leaves[nLeavesMax] (unused ones
+ * -1), padded to 8 bytes, long truth[nWords] }.
+ */
+static inline int abc2java_CutsRecordBytes( abc2java_Cuts_t * p )
+{
+    return 8 * ((2 + p->nLeavesMax + 1) / 2) + 8 * p->nWords;
+}
+
+static jlong abc2java_CutsNum( abc2java_Cuts_t * p )
+{
+    jlong nCuts = 0;
+    int i;
+    for ( i = 0; i < p->nObjs; i++ )
+        nCuts += p->pNum[i];
+    return nCuts;
+}
+
+static void abc2java_CutsWrite( abc2java_Cuts_t * p, char * pOut )
+{
+    int i, k, c, Slot, * pHead;
+    int K = p->nLeavesMax, nHeadInts = 2 * ((2 + K + 1) / 2);
+
+    for ( i = 0; i < Vec_IntSize(p->vOrder); i++ )
+    {
+        int Id = Vec_IntEntry( p->vOrder, i );
+        for ( c = 0; c < p->pNum[Id]; c++ )
+        {
+            Slot = p->pSlot0[Id] + c;
+            pHead = (int *)pOut;
+            pHead[0] = Id;
+            pHead[1] = p->pSizes[Slot];
+            for ( k = 0; k < nHeadInts - 2; k++ )
+                pHead[2 + k] = k < p->pSizes[Slot] ? p->pLeaves[(size_t)Slot * K + k] : -1;
+            memcpy( pOut + 4 * nHeadInts, p->pTruths + (size_t)Slot * p->nWords, sizeof(word) * p->nWords );
+            pOut += abc2java_CutsRecordBytes( p );
+        }
+    }
+}
+
+static abc2java_Cuts_t * abc2java_IvyCuts( Ivy_Man_t * pMan, int nLeavesMax, int nCutsMax, int nThreads )
+{
+    abc2java_Cuts_t * p;
+    Ivy_Obj_t * pObj;
+    int i;
+
+    p = abc2java_CutsAlloc( Ivy_ManObjIdMax(pMan) + 1, nLeavesMax, nCutsMax );
+    Ivy_ManForEachObj( pMan, pObj, i )
+    {
+        if ( !Ivy_ObjIsNode(pObj) && !Ivy_ObjIsBuf(pObj) )
+            continue;
+        // a buffer is the AND of its fanin with itself
+        p->pFan0[i] = Abc_Var2Lit( Ivy_ObjFanin0(pObj)->Id, Ivy_ObjFaninC0(pObj) );
+        p->pFan1[i] = Ivy_ObjIsBuf(pObj) ? p->pFan0[i] : Abc_Var2Lit( Ivy_ObjFanin1(pObj)->Id, Ivy_ObjFaninC1(pObj) );
+        p->pXor[i]  = Ivy_ObjIsExor(pObj);
+    }
+    abc2java_CutsCompute( p, nThreads );
+    return p;
+}
+
+#ifndef ABC2JAVA_LEAN
+static abc2java_Cuts_t * abc2java_NtkCuts( Abc_Ntk_t * pNtk, int nLeavesMax, int nCutsMax, int nThreads )
+{
+    abc2java_Cuts_t * p;
+    Abc_Obj_t * pObj;
+    int i;
+
+    p = abc2java_CutsAlloc( Abc_NtkObjNumMax(pNtk), nLeavesMax, nCutsMax );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        if ( !Abc_AigNodeIsAnd(pObj) )
+            continue;
+        p->pFan0[i] = Abc_Var2Lit( Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj) );
+        p->pFan1[i] = Abc_Var2Lit( Abc_ObjFaninId1(pObj), Abc_ObjFaninC1(pObj) );
+    }
+    abc2java_CutsCompute( p, nThreads );
+    return p;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkCuts
+  (JNIEnv *env, jclass, jlong pAig, jint nLeavesMax, jint nCutsMax, jint nThreads) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || !abc2java_CutsValid( nLeavesMax, nCutsMax )) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_NtkCuts( pNtk, nLeavesMax, nCutsMax, nThreads ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1ManCuts
+  (JNIEnv *env, jclass, jlong fAig, jint nLeavesMax, jint nCutsMax, jint nThreads) {
+    ABC2JAVA_TRACE_TIMED();
+    jlong result = 0;
+
+    if (!abc2java_CutsValid( nLeavesMax, nCutsMax )) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_IvyCuts( reinterpret_cast<Ivy_Man_t *>(fAig), nLeavesMax, nCutsMax, nThreads ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1CutsNum
+  (JNIEnv *env, jclass, jlong pCuts) {
+    ABC2JAVA_TRACE_CALL();
+    return abc2java_CutsNum( reinterpret_cast<abc2java_Cuts_t *>(pCuts) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1CutsRecordBytes
+  (JNIEnv *env, jclass, jlong pCuts) {
+    ABC2JAVA_TRACE_CALL();
+    return abc2java_CutsRecordBytes( reinterpret_cast<abc2java_Cuts_t *>(pCuts) );
+}
+
+/*
+ * { cpu, NUMA node, status } of each thread that computed the cuts
+ * (see THREAD PLACEMENT).
+ */
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1CutsReadPlacement
+  (JNIEnv *env, jclass, jlong pCuts) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+    abc2java_Cuts_t *p = reinterpret_cast<abc2java_Cuts_t *>(pCuts);
+
+    try {
+        result = convertToIntArray(env, Vec_IntAllocArrayCopy( p->pPlacement, ABC2JAVA_PLACE_INTS * p->nThreads ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+/*
+ * Writes all cuts, node by node in level order (native byte order).
+ * Returns the number of records written, or -1 if the buffer is not a
+ * direct buffer or is too small.
+ */
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1CutsWrite
+  (JNIEnv *env, jclass, jlong pCuts, jobject buf) {
+    ABC2JAVA_TRACE_TIMED();
+    abc2java_Cuts_t *p = reinterpret_cast<abc2java_Cuts_t *>(pCuts);
+    char *pOut = reinterpret_cast<char *>(env->GetDirectBufferAddress(buf));
+    jlong nCuts = abc2java_CutsNum( p );
+
+    if (pOut == NULL || env->GetDirectBufferCapacity(buf) < nCuts * abc2java_CutsRecordBytes(p)) {
+        return -1;
+    }
+    abc2java_CutsWrite( p, pOut );
+    return nCuts;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1CutsFree
+  (JNIEnv *env, jclass, jlong pCuts) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_CutsFree( reinterpret_cast<abc2java_Cuts_t *>(pCuts) );
+}
+
+
+#ifndef ABC2JAVA_LEAN
+//////////////////////////////////////
+// LUT MAPPING
+//////////////////////////////////////
+
+/*
+ * In-process 'if' mapping of a strashed network. The mapped netlist is
+ * read straight off the best cuts of the If manager, which is freed
+ * before returning; what is kept is
+ *
+ *   netlist: { nCis, nLuts, nCos, per LUT: nFanins, fanin vars...,
+ *              per CO: driver literal }
+ *   truths:  nWords = max(1, 2^(nLutSize-6)) words per LUT, fanin i
+ *            being variable i
+ *
+ * Variables are numbered as in the Gia arrays: 0 the constant 0, 1..nCis
+ * the CIs, then the LUTs in topological order. Area is the LUT count,
+ * depth the LUT levels.
+ */
+#define ABC2JAVA_LUT_SIZE_MAX 10
+
+typedef struct abc2java_LutMap_t_
+{
+    int          nLutSize;
+    int          nWords;
+    int          nLuts;
+    int          nDepth;
+    Vec_Int_t *  vNetlist;
+    word *       pTruths;
+} abc2java_LutMap_t;
+
+static void abc2java_LutMapFree( abc2java_LutMap_t * p )
+{
+    Vec_IntFree( p->vNetlist );
+    ABC_FREE( p->pTruths );
+    ABC_FREE( p );
+}
+
+// copies the truth table of a cut, replicated to nWords words
+static void abc2java_LutMapTruth( If_Man_t * pIfMan, If_Cut_t * pCut, word * pTruth, int nWords )
+{
+    int w, nCutWords = Abc_TtWordNum( pCut->nLeaves );
+
+    Abc_TtCopy( pTruth, If_CutTruthW(pIfMan, pCut), nCutWords, If_CutTruthIsCompl(pCut) );
+    if ( pCut->nLeaves < 6 )
+        pTruth[0] = Abc_Tt6Stretch( pTruth[0], pCut->nLeaves );
+    for ( w = nCutWords; w < nWords; w++ )
+        pTruth[w] = pTruth[w % nCutWords];
+}
+
+/*
+ * Collects the LUTs reachable from the COs through the best cuts in
+ * topological order (iteratively) and builds the flat netlist.
+ */
+static abc2java_LutMap_t * abc2java_LutMapDerive( If_Man_t * pIfMan, int nLutSize )
+{
+    abc2java_LutMap_t * p;
+    If_Obj_t * pObj, * pLeaf;
+    If_Cut_t * pCut;
+    Vec_Ptr_t * vLuts, * vStack;
+    int * pLits, * pLevels, i, k, fReady, Level;
+
+    pLits = ABC_FALLOC( int, If_ManObjNum(pIfMan) );
+    pLits[If_ManConst1(pIfMan)->Id] = 1;
+    If_ManForEachCi( pIfMan, pObj, i )
+        pLits[pObj->Id] = Abc_Var2Lit( 1 + i, 0 );
+
+    vLuts = Vec_PtrAlloc( 1000 );
+    vStack = Vec_PtrAlloc( 100 );
+    If_ManForEachCo( pIfMan, pObj, i )
+    {
+        Vec_PtrPush( vStack, If_ObjFanin0(pObj) );
+        while ( Vec_PtrSize(vStack) > 0 )
+        {
+            pObj = (If_Obj_t *)Vec_PtrEntryLast( vStack );
+            if ( pLits[pObj->Id] >= 0 )
+            {
+                Vec_PtrPop( vStack );
+                continue;
+            }
+            pCut = If_ObjCutBest( pObj );
+            fReady = 1;
+            If_CutForEachLeaf( pIfMan, pCut, pLeaf, k )
+                if ( pLits[pLeaf->Id] < 0 )
+                {
+                    Vec_PtrPush( vStack, pLeaf );
+                    fReady = 0;
+                }
+            if ( !fReady )
+                continue;
+            pLits[pObj->Id] = Abc_Var2Lit( 1 + If_ManCiNum(pIfMan) + Vec_PtrSize(vLuts), 0 );
+            Vec_PtrPush( vLuts, pObj );
+            Vec_PtrPop( vStack );
+        }
+    }
+    Vec_PtrFree( vStack );
+
+    p = ABC_CALLOC( abc2java_LutMap_t, 1 );
+    p->nLutSize = nLutSize;
+    p->nWords   = Abc_TtWordNum( nLutSize );
+    p->nLuts    = Vec_PtrSize( vLuts );
+    p->vNetlist = Vec_IntAlloc( 3 + p->nLuts * (nLutSize + 1) + If_ManCoNum(pIfMan) );
+    p->pTruths  = ABC_ALLOC( word, (size_t)p->nLuts * p->nWords + 1 );
+    Vec_IntPush( p->vNetlist, If_ManCiNum(pIfMan) );
+    Vec_IntPush( p->vNetlist, p->nLuts );
+    Vec_IntPush( p->vNetlist, If_ManCoNum(pIfMan) );
+    // levels are indexed by variable; CIs and the constant are level 0
+    pLevels = ABC_CALLOC( int, 1 + If_ManCiNum(pIfMan) + p->nLuts );
+    Vec_PtrForEachEntry( If_Obj_t *, vLuts, pObj, i )
+    {
+        pCut = If_ObjCutBest( pObj );
+        Level = 0;
+        Vec_IntPush( p->vNetlist, pCut->nLeaves );
+        If_CutForEachLeaf( pIfMan, pCut, pLeaf, k )
+        {
+            Vec_IntPush( p->vNetlist, Abc_Lit2Var(pLits[pLeaf->Id]) );
+            Level = Abc_MaxInt( Level, pLevels[Abc_Lit2Var(pLits[pLeaf->Id])] );
+        }
+        pLevels[Abc_Lit2Var(pLits[pObj->Id])] = Level + 1;
+        p->nDepth = Abc_MaxInt( p->nDepth, Level + 1 );
+        abc2java_LutMapTruth( pIfMan, pCut, p->pTruths + (size_t)i * p->nWords, p->nWords );
+    }
+    If_ManForEachCo( pIfMan, pObj, i )
+        Vec_IntPush( p->vNetlist, Abc_LitNotCond(pLits[If_ObjFanin0(pObj)->Id], If_ObjFaninC0(pObj)) );
+    ABC_FREE( pLevels );
+    Vec_PtrFree( vLuts );
+    ABC_FREE( pLits );
+    return p;
+}
+
+/*
+ * Maps with unit-delay LUTs; fArea selects area-oriented mapping. The
+ * choices of the network are used with fChoices, otherwise they are
+ * removed by restrashing a copy first. Returns NULL if mapping fails.
+ */
+static abc2java_LutMap_t * abc2java_NtkLutMap( Abc_Ntk_t * pNtk, int nLutSize, int nCutsMax, int fArea, int fChoices )
+{
+    abc2java_LutMap_t * p = NULL;
+    Abc_Ntk_t * pNtkMap = pNtk;
+    If_Man_t * pIfMan;
+    If_Par_t Pars;
+
+    If_ManSetDefaultPars( &Pars );
+    Pars.nLutSize = nLutSize;
+    Pars.nCutsMax = nCutsMax;
+    Pars.fArea    = fArea;
+    Pars.fTruth   = 1;
+    Pars.fCutMin  = 0;
+    Pars.pLutLib  = NULL;
+    Pars.fVerbose = 0;
+    if ( Abc_NtkGetChoiceNum(pNtk) > 0 )
+    {
+        if ( fChoices )
+            Pars.fExpRed = 0;
+        else
+            pNtkMap = Abc_NtkRestrash( pNtk, 0 );
+    }
+    pIfMan = Abc_NtkToIf( pNtkMap, &Pars );
+    if ( pIfMan != NULL )
+    {
+        if ( If_ManPerformMapping( pIfMan ) )
+            p = abc2java_LutMapDerive( pIfMan, nLutSize );
+        If_ManStop( pIfMan );
+    }
+    if ( pNtkMap != pNtk )
+        Abc_NtkDelete( pNtkMap );
+    return p;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkLutMap
+  (JNIEnv *env, jclass, jlong pAig, jint nLutSize, jint nCutsMax, jboolean fArea, jboolean fChoices) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || nLutSize < 2 || nLutSize > ABC2JAVA_LUT_SIZE_MAX || nCutsMax < 1) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_NtkLutMap( pNtk, nLutSize, nCutsMax, fArea, fChoices ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1LutMapArea
+  (JNIEnv *env, jclass, jlong pMap) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<abc2java_LutMap_t *>(pMap)->nLuts;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1LutMapDepth
+  (JNIEnv *env, jclass, jlong pMap) {
+    ABC2JAVA_TRACE_CALL();
+    return reinterpret_cast<abc2java_LutMap_t *>(pMap)->nDepth;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1LutMapNetlist
+  (JNIEnv *env, jclass, jlong pMap) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_LutMap_t *p = reinterpret_cast<abc2java_LutMap_t *>(pMap);
+    jintArray result = env->NewIntArray(Vec_IntSize(p->vNetlist));
+
+    if (result == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        env->SetIntArrayRegion(result, 0, Vec_IntSize(p->vNetlist), Vec_IntArray(p->vNetlist));
+    }
+    return result;
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Abc_1LutMapTruths
+  (JNIEnv *env, jclass, jlong pMap) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_LutMap_t *p = reinterpret_cast<abc2java_LutMap_t *>(pMap);
+    jsize nWords = p->nLuts * p->nWords;
+    jlongArray result = env->NewLongArray(nWords);
+
+    if (result == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        env->SetLongArrayRegion(result, 0, nWords, reinterpret_cast<jlong *>(p->pTruths));
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1LutMapFree
+  (JNIEnv *env, jclass, jlong pMap) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_LutMapFree( reinterpret_cast<abc2java_LutMap_t *>(pMap) );
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// QUANTIFICATION
+//////////////////////////////////////
+
+/*
+ * Cofactors, composition and existential quantification of single cones,
+ * built in the manager the cone lives in. All of them come down to one
+ * iterative substitution pass that rebuilds the cone bottom up with some
+ * PIs replaced; the unchanged parts come back as the same nodes through
+ * structural hashing. The map of the pass is indexed by node number (id)
+ * and only the entries it wrote are cleared afterwards, so that repeated
+ * passes cost the size of the cone rather than of the manager.
+ *
+ * Quantification ORs the two cofactors, one variable at a time. In a
+ * Fraig manager every node built is functionally reduced on the fly. Abc
+ * and Ivy cones quantified with nConfLimit > 0 are copied into a scratch
+ * Fraig manager, quantified there and copied back, so the intermediate
+ * results are FRAIG-reduced after every variable and only the reduced
+ * result is added to the network.
+ */
+typedef struct abc2java_Subst_t_
+{
+    Vec_Ptr_t *  vMap;      // node number (id) -> copy
+    Vec_Ptr_t *  vStack;
+    Vec_Ptr_t *  vWritten;  // nodes with a map entry
+} abc2java_Subst_t;
+
+static abc2java_Subst_t * abc2java_SubstAlloc()
+{
+    abc2java_Subst_t * p = ABC_CALLOC( abc2java_Subst_t, 1 );
+    p->vMap     = Vec_PtrAlloc( 1000 );
+    p->vStack   = Vec_PtrAlloc( 100 );
+    p->vWritten = Vec_PtrAlloc( 1000 );
+    return p;
+}
+
+static void abc2java_SubstFree( abc2java_Subst_t * p )
+{
+    Vec_PtrFree( p->vMap );
+    Vec_PtrFree( p->vStack );
+    Vec_PtrFree( p->vWritten );
+    ABC_FREE( p );
+}
+
+static void abc2java_QuantFraigParams( Fraig_Params_t * pParams, int nConfLimit )
+{
+    Fraig_ParamsSetDefault( pParams );
+    pParams->nBTLimit  = nConfLimit;
+    pParams->fFuncRed  = 1;
+    pParams->fDoSparse = 1;
+}
+
+/*
+ * Rebuilds the cone of pRoot with pVars[i] replaced by pFuncs[i].
+ */
+static Fraig_Node_t * abc2java_FraigSubst( abc2java_Subst_t * p, Fraig_Man_t * fMan, Fraig_Node_t * pRoot,
+                                           const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    Fraig_Node_t * pNode, * pChild0, * pChild1, * pRes;
+    int i;
+
+    Vec_PtrFillExtra( p->vMap, fMan->vNodes->nSize, NULL );
+    Vec_PtrClear( p->vWritten );
+    for ( i = 0; i < nVars; i++ )
+    {
+        pNode = reinterpret_cast<Fraig_Node_t *>(pVars[i]);
+        Vec_PtrWriteEntry( p->vMap, pNode->Num, reinterpret_cast<Fraig_Node_t *>(pFuncs[i]) );
+        Vec_PtrPush( p->vWritten, pNode );
+    }
+    Vec_PtrClear( p->vStack );
+    Vec_PtrPush( p->vStack, Fraig_Regular(pRoot) );
+    while ( Vec_PtrSize(p->vStack) > 0 )
+    {
+        pNode = (Fraig_Node_t *)Vec_PtrEntryLast( p->vStack );
+        if ( Vec_PtrEntry(p->vMap, pNode->Num) )
+        {
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( !Fraig_NodeIsAnd(pNode) )
+        {
+            Vec_PtrWriteEntry( p->vMap, pNode->Num, pNode );
+            Vec_PtrPush( p->vWritten, pNode );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        pChild0 = (Fraig_Node_t *)Vec_PtrEntry( p->vMap, Fraig_Regular(pNode->p1)->Num );
+        pChild1 = (Fraig_Node_t *)Vec_PtrEntry( p->vMap, Fraig_Regular(pNode->p2)->Num );
+        if ( pChild0 && pChild1 )
+        {
+            Vec_PtrWriteEntry( p->vMap, pNode->Num, Fraig_NodeAnd( fMan, Fraig_NotCond(pChild0, Fraig_IsComplement(pNode->p1)),
+                                                                         Fraig_NotCond(pChild1, Fraig_IsComplement(pNode->p2)) ) );
+            Vec_PtrPush( p->vWritten, pNode );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( p->vStack, Fraig_Regular(pNode->p1) );
+        if ( pChild1 == NULL )
+            Vec_PtrPush( p->vStack, Fraig_Regular(pNode->p2) );
+    }
+    pRes = Fraig_NotCond( (Fraig_Node_t *)Vec_PtrEntry(p->vMap, Fraig_Regular(pRoot)->Num), Fraig_IsComplement(pRoot) );
+    Vec_PtrForEachEntry( Fraig_Node_t *, p->vWritten, pNode, i )
+        Vec_PtrWriteEntry( p->vMap, pNode->Num, NULL );
+    return pRes;
+}
+
+static Fraig_Node_t * abc2java_FraigExists( Fraig_Man_t * fMan, Fraig_Node_t * pRoot, const jlong * pVars, int nVars )
+{
+    abc2java_Subst_t * p = abc2java_SubstAlloc();
+    Fraig_Node_t * pCof0, * pCof1;
+    jlong Const0 = reinterpret_cast<jlong>(Fraig_Not(Fraig_ManReadConst1(fMan)));
+    jlong Const1 = reinterpret_cast<jlong>(Fraig_ManReadConst1(fMan));
+    int i;
+
+    for ( i = 0; i < nVars && Fraig_Regular(pRoot) != Fraig_ManReadConst1(fMan); i++ )
+    {
+        pCof0 = abc2java_FraigSubst( p, fMan, pRoot, pVars + i, &Const0, 1 );
+        pCof1 = abc2java_FraigSubst( p, fMan, pRoot, pVars + i, &Const1, 1 );
+        pRoot = Fraig_NodeOr( fMan, pCof0, pCof1 );
+    }
+    abc2java_SubstFree( p );
+    return pRoot;
+}
+
+/*
+ * Copies the cone of a Fraig node into a network or Ivy manager whose
+ * PIs (CIs) correspond to the Fraig inputs by index.
+ */
+static Ivy_Obj_t * abc2java_FraigToIvy( Ivy_Man_t * pMan, Fraig_Man_t * fMan, Fraig_Node_t * pRoot )
+{
+    Fraig_Node_t * pNode, * pFan0, * pFan1;
+    Ivy_Obj_t ** pMap, * pRes;
+    Vec_Ptr_t * vStack;
+    int i;
+
+    pMap = ABC_CALLOC( Ivy_Obj_t *, fMan->vNodes->nSize );
+    pMap[fMan->pConst1->Num] = Ivy_ManConst1( pMan );
+    for ( i = 0; i < fMan->vInputs->nSize; i++ )
+        pMap[fMan->vInputs->pArray[i]->Num] = Ivy_ManPi( pMan, i );
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Fraig_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pNode = (Fraig_Node_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pNode->Num] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pFan0 = Fraig_Regular(pNode->p1);
+        pFan1 = Fraig_Regular(pNode->p2);
+        if ( pMap[pFan0->Num] && pMap[pFan1->Num] )
+        {
+            pMap[pNode->Num] = Ivy_And( pMan, Ivy_NotCond(pMap[pFan0->Num], Fraig_IsComplement(pNode->p1)),
+                                              Ivy_NotCond(pMap[pFan1->Num], Fraig_IsComplement(pNode->p2)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pMap[pFan0->Num] == NULL )
+            Vec_PtrPush( vStack, pFan0 );
+        if ( pMap[pFan1->Num] == NULL )
+            Vec_PtrPush( vStack, pFan1 );
+    }
+    Vec_PtrFree( vStack );
+    pRes = Ivy_NotCond( pMap[Fraig_Regular(pRoot)->Num], Fraig_IsComplement(pRoot) );
+    ABC_FREE( pMap );
+    return pRes;
+}
+
+static Ivy_Obj_t * abc2java_IvySubst( abc2java_Subst_t * p, Ivy_Man_t * pMan, Ivy_Obj_t * pRoot,
+                                      const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    Ivy_Obj_t * pObj, * pChild0, * pChild1, * pRes;
+    int i;
+
+    Vec_PtrFillExtra( p->vMap, Ivy_ManObjIdMax(pMan) + 1, NULL );
+    Vec_PtrClear( p->vWritten );
+    for ( i = 0; i < nVars; i++ )
+    {
+        pObj = reinterpret_cast<Ivy_Obj_t *>(pVars[i]);
+        Vec_PtrWriteEntry( p->vMap, pObj->Id, reinterpret_cast<Ivy_Obj_t *>(pFuncs[i]) );
+        Vec_PtrPush( p->vWritten, pObj );
+    }
+    Vec_PtrClear( p->vStack );
+    Vec_PtrPush( p->vStack, Ivy_Regular(pRoot) );
+    while ( Vec_PtrSize(p->vStack) > 0 )
+    {
+        pObj = (Ivy_Obj_t *)Vec_PtrEntryLast( p->vStack );
+        if ( Vec_PtrEntry(p->vMap, pObj->Id) )
+        {
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( !Ivy_ObjIsNode(pObj) && !Ivy_ObjIsBuf(pObj) )
+        {
+            Vec_PtrWriteEntry( p->vMap, pObj->Id, pObj );
+            Vec_PtrPush( p->vWritten, pObj );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        pChild0 = (Ivy_Obj_t *)Vec_PtrEntry( p->vMap, Ivy_ObjFanin0(pObj)->Id );
+        pChild1 = Ivy_ObjIsBuf(pObj) ? pChild0 : (Ivy_Obj_t *)Vec_PtrEntry( p->vMap, Ivy_ObjFanin1(pObj)->Id );
+        if ( pChild0 && pChild1 )
+        {
+            pChild0 = Ivy_NotCond( pChild0, Ivy_ObjFaninC0(pObj) );
+            if ( Ivy_ObjIsBuf(pObj) )
+                pRes = pChild0;
+            else if ( Ivy_ObjIsExor(pObj) )
+                pRes = Ivy_Exor( pMan, pChild0, Ivy_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            else
+                pRes = Ivy_And( pMan, pChild0, Ivy_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            Vec_PtrWriteEntry( p->vMap, pObj->Id, pRes );
+            Vec_PtrPush( p->vWritten, pObj );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( p->vStack, Ivy_ObjFanin0(pObj) );
+        if ( pChild1 == NULL && !Ivy_ObjIsBuf(pObj) )
+            Vec_PtrPush( p->vStack, Ivy_ObjFanin1(pObj) );
+    }
+    pRes = Ivy_NotCond( (Ivy_Obj_t *)Vec_PtrEntry(p->vMap, Ivy_Regular(pRoot)->Id), Ivy_IsComplement(pRoot) );
+    Vec_PtrForEachEntry( Ivy_Obj_t *, p->vWritten, pObj, i )
+        Vec_PtrWriteEntry( p->vMap, pObj->Id, NULL );
+    return pRes;
+}
+
+/*
+ * Quantifies in a scratch Fraig manager. The cone goes in through a
+ * substitution of every Ivy PI by the Fraig input of the same index.
+ */
+static Ivy_Obj_t * abc2java_IvyExistsFraig( Ivy_Man_t * pMan, Ivy_Obj_t * pRoot, const jlong * pVars, int nVars, int nConfLimit )
+{
+    Fraig_Params_t Params;
+    Fraig_Man_t * fMan;
+    Fraig_Node_t ** pMap, * pNode, * pChild0, * pChild1, * fRoot;
+    Ivy_Obj_t * pObj;
+    Vec_Ptr_t * vStack;
+    jlong * pFraigVars;
+    int i;
+
+    abc2java_QuantFraigParams( &Params, nConfLimit );
+    fMan = Fraig_ManCreate( &Params );
+    pMap = ABC_CALLOC( Fraig_Node_t *, Ivy_ManObjIdMax(pMan) + 1 );
+    pMap[Ivy_ManConst1(pMan)->Id] = Fraig_ManReadConst1( fMan );
+    Ivy_ManForEachPi( pMan, pObj, i )
+        pMap[pObj->Id] = Fraig_ManReadIthVar( fMan, i );
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Ivy_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pObj = (Ivy_Obj_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pObj->Id] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pChild0 = pMap[Ivy_ObjFanin0(pObj)->Id];
+        pChild1 = Ivy_ObjIsBuf(pObj) ? pChild0 : pMap[Ivy_ObjFanin1(pObj)->Id];
+        if ( pChild0 && pChild1 )
+        {
+            pChild0 = Fraig_NotCond( pChild0, Ivy_ObjFaninC0(pObj) );
+            if ( Ivy_ObjIsBuf(pObj) )
+                pNode = pChild0;
+            else if ( Ivy_ObjIsExor(pObj) )
+                pNode = Fraig_NodeExor( fMan, pChild0, Fraig_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            else
+                pNode = Fraig_NodeAnd( fMan, pChild0, Fraig_NotCond(pChild1, Ivy_ObjFaninC1(pObj)) );
+            pMap[pObj->Id] = pNode;
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( vStack, Ivy_ObjFanin0(pObj) );
+        if ( pChild1 == NULL && !Ivy_ObjIsBuf(pObj) )
+            Vec_PtrPush( vStack, Ivy_ObjFanin1(pObj) );
+    }
+    Vec_PtrFree( vStack );
+    fRoot = Fraig_NotCond( pMap[Ivy_Regular(pRoot)->Id], Ivy_IsComplement(pRoot) );
+    pFraigVars = ABC_ALLOC( jlong, nVars + 1 );
+    for ( i = 0; i < nVars; i++ )
+        pFraigVars[i] = reinterpret_cast<jlong>(pMap[reinterpret_cast<Ivy_Obj_t *>(pVars[i])->Id]);
+    ABC_FREE( pMap );
+
+    fRoot = abc2java_FraigExists( fMan, fRoot, pFraigVars, nVars );
+    pObj = abc2java_FraigToIvy( pMan, fMan, fRoot );
+    ABC_FREE( pFraigVars );
+    Fraig_ManFree( fMan );
+    return pObj;
+}
+
+static Ivy_Obj_t * abc2java_IvyExists( Ivy_Man_t * pMan, Ivy_Obj_t * pRoot, const jlong * pVars, int nVars, int nConfLimit )
+{
+    abc2java_Subst_t * p;
+    Ivy_Obj_t * pCof0, * pCof1;
+    jlong Const0 = reinterpret_cast<jlong>(Ivy_Not(Ivy_ManConst1(pMan)));
+    jlong Const1 = reinterpret_cast<jlong>(Ivy_ManConst1(pMan));
+    int i;
+
+    if ( nConfLimit > 0 )
+        return abc2java_IvyExistsFraig( pMan, pRoot, pVars, nVars, nConfLimit );
+    p = abc2java_SubstAlloc();
+    for ( i = 0; i < nVars && Ivy_Regular(pRoot) != Ivy_ManConst1(pMan); i++ )
+    {
+        pCof0 = abc2java_IvySubst( p, pMan, pRoot, pVars + i, &Const0, 1 );
+        pCof1 = abc2java_IvySubst( p, pMan, pRoot, pVars + i, &Const1, 1 );
+        pRoot = Ivy_Or( pMan, pCof0, pCof1 );
+    }
+    abc2java_SubstFree( p );
+    return pRoot;
+}
+
+/*
+ * Variables are passed as PI (CI) handles and must be regular; functions
+ * may be complemented but not 0.
+ */
+static int abc2java_FraigVarsValid( const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    int i;
+    for ( i = 0; i < nVars; i++ )
+    {
+        Fraig_Node_t * pVar = reinterpret_cast<Fraig_Node_t *>(pVars[i]);
+        if ( pVar == NULL || Fraig_IsComplement(pVar) || !Fraig_NodeIsVar(pVar) || (pFuncs && pFuncs[i] == 0) )
+            return 0;
+    }
+    return 1;
+}
+
+static int abc2java_IvyVarsValid( const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    int i;
+    for ( i = 0; i < nVars; i++ )
+    {
+        Ivy_Obj_t * pVar = reinterpret_cast<Ivy_Obj_t *>(pVars[i]);
+        if ( pVar == NULL || Ivy_IsComplement(pVar) || !Ivy_ObjIsPi(pVar) || (pFuncs && pFuncs[i] == 0) )
+            return 0;
+    }
+    return 1;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeCofactor
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlong fVar, jboolean fValue) {
+    ABC2JAVA_TRACE_CALL();
+    Fraig_Man_t *fMan = reinterpret_cast<Fraig_Man_t *>(fAig);
+    jlong Func = reinterpret_cast<jlong>(Fraig_NotCond(Fraig_ManReadConst1(fMan), !fValue));
+    jlong result = 0;
+
+    if (fObj == 0 || !abc2java_FraigVarsValid(&fVar, NULL, 1)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        abc2java_Subst_t *p = abc2java_SubstAlloc();
+        result = reinterpret_cast<jlong>(abc2java_FraigSubst( p, fMan, reinterpret_cast<Fraig_Node_t *>(fObj), &fVar, &Func, 1 ));
+        abc2java_SubstFree( p );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeCompose
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlongArray vars, jlongArray funcs) {
+    ABC2JAVA_TRACE_TIMED();
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars, *pFuncs;
+    jlong result = 0;
+
+    if (fObj == 0 || env->GetArrayLength(funcs) != nVars) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    pFuncs = env->GetLongArrayElements(funcs, NULL);
+    if (pVars == NULL || pFuncs == NULL) {
+        out_of_mem_exception(env);
+    } else if (!abc2java_FraigVarsValid(pVars, pFuncs, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            abc2java_Subst_t *p = abc2java_SubstAlloc();
+            result = reinterpret_cast<jlong>(abc2java_FraigSubst( p, reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                                  reinterpret_cast<Fraig_Node_t *>(fObj), pVars, pFuncs, nVars ));
+            abc2java_SubstFree( p );
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pVars != NULL) env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    if (pFuncs != NULL) env->ReleaseLongArrayElements(funcs, pFuncs, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Fraig_1NodeExists
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlongArray vars) {
+    ABC2JAVA_TRACE_TIMED();
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars;
+    jlong result = 0;
+
+    if (fObj == 0) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    if (pVars == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    if (!abc2java_FraigVarsValid(pVars, NULL, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            result = reinterpret_cast<jlong>(abc2java_FraigExists( reinterpret_cast<Fraig_Man_t *>(fAig),
+                                                                   reinterpret_cast<Fraig_Node_t *>(fObj), pVars, nVars ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Cofactor
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlong fVar, jboolean fValue) {
+    ABC2JAVA_TRACE_CALL();
+    Ivy_Man_t *pMan = reinterpret_cast<Ivy_Man_t *>(fAig);
+    jlong Func = reinterpret_cast<jlong>(Ivy_NotCond(Ivy_ManConst1(pMan), !fValue));
+    jlong result = 0;
+
+    if (fObj == 0 || !abc2java_IvyVarsValid(&fVar, NULL, 1)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        abc2java_Subst_t *p = abc2java_SubstAlloc();
+        result = reinterpret_cast<jlong>(abc2java_IvySubst( p, pMan, reinterpret_cast<Ivy_Obj_t *>(fObj), &fVar, &Func, 1 ));
+        abc2java_SubstFree( p );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Compose
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlongArray vars, jlongArray funcs) {
+    ABC2JAVA_TRACE_TIMED();
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars, *pFuncs;
+    jlong result = 0;
+
+    if (fObj == 0 || env->GetArrayLength(funcs) != nVars) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    pFuncs = env->GetLongArrayElements(funcs, NULL);
+    if (pVars == NULL || pFuncs == NULL) {
+        out_of_mem_exception(env);
+    } else if (!abc2java_IvyVarsValid(pVars, pFuncs, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            abc2java_Subst_t *p = abc2java_SubstAlloc();
+            result = reinterpret_cast<jlong>(abc2java_IvySubst( p, reinterpret_cast<Ivy_Man_t *>(fAig),
+                                                                reinterpret_cast<Ivy_Obj_t *>(fObj), pVars, pFuncs, nVars ));
+            abc2java_SubstFree( p );
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pVars != NULL) env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    if (pFuncs != NULL) env->ReleaseLongArrayElements(funcs, pFuncs, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Ivy_1Exists
+  (JNIEnv *env, jclass, jlong fAig, jlong fObj, jlongArray vars, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars;
+    jlong result = 0;
+
+    if (fObj == 0) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    if (pVars == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    if (!abc2java_IvyVarsValid(pVars, NULL, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            result = reinterpret_cast<jlong>(abc2java_IvyExists( reinterpret_cast<Ivy_Man_t *>(fAig),
+                                                                 reinterpret_cast<Ivy_Obj_t *>(fObj), pVars, nVars, nConfLimit ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    return result;
+}
+
+#ifndef ABC2JAVA_LEAN
+static Abc_Obj_t * abc2java_NtkSubst( abc2java_Subst_t * p, Abc_Ntk_t * pNtk, Abc_Obj_t * pRoot,
+                                      const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    Abc_Aig_t * pAig = (Abc_Aig_t *)pNtk->pManFunc;
+    Abc_Obj_t * pObj, * pChild0, * pChild1, * pRes;
+    int i;
+
+    Vec_PtrFillExtra( p->vMap, Abc_NtkObjNumMax(pNtk), NULL );
+    Vec_PtrClear( p->vWritten );
+    for ( i = 0; i < nVars; i++ )
+    {
+        pObj = reinterpret_cast<Abc_Obj_t *>(pVars[i]);
+        Vec_PtrWriteEntry( p->vMap, pObj->Id, reinterpret_cast<Abc_Obj_t *>(pFuncs[i]) );
+        Vec_PtrPush( p->vWritten, pObj );
+    }
+    Vec_PtrClear( p->vStack );
+    Vec_PtrPush( p->vStack, Abc_ObjRegular(pRoot) );
+    while ( Vec_PtrSize(p->vStack) > 0 )
+    {
+        pObj = (Abc_Obj_t *)Vec_PtrEntryLast( p->vStack );
+        if ( Vec_PtrEntry(p->vMap, pObj->Id) )
+        {
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( !Abc_AigNodeIsAnd(pObj) )
+        {
+            Vec_PtrWriteEntry( p->vMap, pObj->Id, pObj );
+            Vec_PtrPush( p->vWritten, pObj );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        pChild0 = (Abc_Obj_t *)Vec_PtrEntry( p->vMap, Abc_ObjFaninId0(pObj) );
+        pChild1 = (Abc_Obj_t *)Vec_PtrEntry( p->vMap, Abc_ObjFaninId1(pObj) );
+        if ( pChild0 && pChild1 )
+        {
+            Vec_PtrWriteEntry( p->vMap, pObj->Id, Abc_AigAnd( pAig, Abc_ObjNotCond(pChild0, Abc_ObjFaninC0(pObj)),
+                                                                    Abc_ObjNotCond(pChild1, Abc_ObjFaninC1(pObj)) ) );
+            Vec_PtrPush( p->vWritten, pObj );
+            Vec_PtrPop( p->vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( p->vStack, Abc_ObjFanin0(pObj) );
+        if ( pChild1 == NULL )
+            Vec_PtrPush( p->vStack, Abc_ObjFanin1(pObj) );
+    }
+    pRes = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(p->vMap, Abc_ObjRegular(pRoot)->Id), Abc_ObjIsComplement(pRoot) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vWritten, pObj, i )
+        Vec_PtrWriteEntry( p->vMap, pObj->Id, NULL );
+    return pRes;
+}
+
+static Abc_Obj_t * abc2java_FraigToNtk( Abc_Ntk_t * pNtk, Fraig_Man_t * fMan, Fraig_Node_t * pRoot )
+{
+    Abc_Aig_t * pAig = (Abc_Aig_t *)pNtk->pManFunc;
+    Fraig_Node_t * pNode, * pFan0, * pFan1;
+    Abc_Obj_t ** pMap, * pRes;
+    Vec_Ptr_t * vStack;
+    int i;
+
+    pMap = ABC_CALLOC( Abc_Obj_t *, fMan->vNodes->nSize );
+    pMap[fMan->pConst1->Num] = Abc_AigConst1( pNtk );
+    for ( i = 0; i < fMan->vInputs->nSize; i++ )
+        pMap[fMan->vInputs->pArray[i]->Num] = Abc_NtkCi( pNtk, i );
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Fraig_Regular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pNode = (Fraig_Node_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pNode->Num] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pFan0 = Fraig_Regular(pNode->p1);
+        pFan1 = Fraig_Regular(pNode->p2);
+        if ( pMap[pFan0->Num] && pMap[pFan1->Num] )
+        {
+            pMap[pNode->Num] = Abc_AigAnd( pAig, Abc_ObjNotCond(pMap[pFan0->Num], Fraig_IsComplement(pNode->p1)),
+                                                 Abc_ObjNotCond(pMap[pFan1->Num], Fraig_IsComplement(pNode->p2)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pMap[pFan0->Num] == NULL )
+            Vec_PtrPush( vStack, pFan0 );
+        if ( pMap[pFan1->Num] == NULL )
+            Vec_PtrPush( vStack, pFan1 );
+    }
+    Vec_PtrFree( vStack );
+    pRes = Abc_ObjNotCond( pMap[Fraig_Regular(pRoot)->Num], Fraig_IsComplement(pRoot) );
+    ABC_FREE( pMap );
+    return pRes;
+}
+
+static Abc_Obj_t * abc2java_NtkExistsFraig( Abc_Ntk_t * pNtk, Abc_Obj_t * pRoot, const jlong * pVars, int nVars, int nConfLimit )
+{
+    Fraig_Params_t Params;
+    Fraig_Man_t * fMan;
+    Fraig_Node_t ** pMap, * pChild0, * pChild1, * fRoot;
+    Abc_Obj_t * pObj;
+    Vec_Ptr_t * vStack;
+    jlong * pFraigVars;
+    int i;
+
+    abc2java_QuantFraigParams( &Params, nConfLimit );
+    fMan = Fraig_ManCreate( &Params );
+    pMap = ABC_CALLOC( Fraig_Node_t *, Abc_NtkObjNumMax(pNtk) );
+    pMap[Abc_AigConst1(pNtk)->Id] = Fraig_ManReadConst1( fMan );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        pMap[pObj->Id] = Fraig_ManReadIthVar( fMan, i );
+    vStack = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vStack, Abc_ObjRegular(pRoot) );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pObj = (Abc_Obj_t *)Vec_PtrEntryLast( vStack );
+        if ( pMap[pObj->Id] )
+        {
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        pChild0 = pMap[Abc_ObjFaninId0(pObj)];
+        pChild1 = pMap[Abc_ObjFaninId1(pObj)];
+        if ( pChild0 && pChild1 )
+        {
+            pMap[pObj->Id] = Fraig_NodeAnd( fMan, Fraig_NotCond(pChild0, Abc_ObjFaninC0(pObj)),
+                                                  Fraig_NotCond(pChild1, Abc_ObjFaninC1(pObj)) );
+            Vec_PtrPop( vStack );
+            continue;
+        }
+        if ( pChild0 == NULL )
+            Vec_PtrPush( vStack, Abc_ObjFanin0(pObj) );
+        if ( pChild1 == NULL )
+            Vec_PtrPush( vStack, Abc_ObjFanin1(pObj) );
+    }
+    Vec_PtrFree( vStack );
+    fRoot = Fraig_NotCond( pMap[Abc_ObjRegular(pRoot)->Id], Abc_ObjIsComplement(pRoot) );
+    pFraigVars = ABC_ALLOC( jlong, nVars + 1 );
+    for ( i = 0; i < nVars; i++ )
+        pFraigVars[i] = reinterpret_cast<jlong>(pMap[reinterpret_cast<Abc_Obj_t *>(pVars[i])->Id]);
+    ABC_FREE( pMap );
+
+    fRoot = abc2java_FraigExists( fMan, fRoot, pFraigVars, nVars );
+    pObj = abc2java_FraigToNtk( pNtk, fMan, fRoot );
+    ABC_FREE( pFraigVars );
+    Fraig_ManFree( fMan );
+    return pObj;
+}
+
+static Abc_Obj_t * abc2java_NtkExists( Abc_Ntk_t * pNtk, Abc_Obj_t * pRoot, const jlong * pVars, int nVars, int nConfLimit )
+{
+    abc2java_Subst_t * p;
+    Abc_Obj_t * pCof0, * pCof1;
+    jlong Const0 = reinterpret_cast<jlong>(Abc_ObjNot(Abc_AigConst1(pNtk)));
+    jlong Const1 = reinterpret_cast<jlong>(Abc_AigConst1(pNtk));
+    int i;
+
+    if ( nConfLimit > 0 )
+        return abc2java_NtkExistsFraig( pNtk, pRoot, pVars, nVars, nConfLimit );
+    p = abc2java_SubstAlloc();
+    for ( i = 0; i < nVars && Abc_ObjRegular(pRoot) != Abc_AigConst1(pNtk); i++ )
+    {
+        pCof0 = abc2java_NtkSubst( p, pNtk, pRoot, pVars + i, &Const0, 1 );
+        pCof1 = abc2java_NtkSubst( p, pNtk, pRoot, pVars + i, &Const1, 1 );
+        pRoot = Abc_AigOr( (Abc_Aig_t *)pNtk->pManFunc, pCof0, pCof1 );
+    }
+    abc2java_SubstFree( p );
+    return pRoot;
+}
+
+static int abc2java_NtkVarsValid( const jlong * pVars, const jlong * pFuncs, int nVars )
+{
+    int i;
+    for ( i = 0; i < nVars; i++ )
+    {
+        Abc_Obj_t * pVar = reinterpret_cast<Abc_Obj_t *>(pVars[i]);
+        if ( pVar == NULL || Abc_ObjIsComplement(pVar) || !Abc_ObjIsCi(pVar) || (pFuncs && pFuncs[i] == 0) )
+            return 0;
+    }
+    return 1;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigCofactor
+  (JNIEnv *env, jclass, jlong pAig, jlong pObj, jlong pVar, jboolean fValue) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong Func = reinterpret_cast<jlong>(Abc_ObjNotCond(Abc_AigConst1(pNtk), !fValue));
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || pObj == 0 || !abc2java_NtkVarsValid(&pVar, NULL, 1)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        abc2java_Subst_t *p = abc2java_SubstAlloc();
+        result = reinterpret_cast<jlong>(abc2java_NtkSubst( p, pNtk, reinterpret_cast<Abc_Obj_t *>(pObj), &pVar, &Func, 1 ));
+        abc2java_SubstFree( p );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigCompose
+  (JNIEnv *env, jclass, jlong pAig, jlong pObj, jlongArray vars, jlongArray funcs) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars, *pFuncs;
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || pObj == 0 || env->GetArrayLength(funcs) != nVars) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    pFuncs = env->GetLongArrayElements(funcs, NULL);
+    if (pVars == NULL || pFuncs == NULL) {
+        out_of_mem_exception(env);
+    } else if (!abc2java_NtkVarsValid(pVars, pFuncs, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            abc2java_Subst_t *p = abc2java_SubstAlloc();
+            result = reinterpret_cast<jlong>(abc2java_NtkSubst( p, pNtk, reinterpret_cast<Abc_Obj_t *>(pObj), pVars, pFuncs, nVars ));
+            abc2java_SubstFree( p );
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    if (pVars != NULL) env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    if (pFuncs != NULL) env->ReleaseLongArrayElements(funcs, pFuncs, JNI_ABORT);
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1AigExists
+  (JNIEnv *env, jclass, jlong pAig, jlong pObj, jlongArray vars, jint nConfLimit) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jsize nVars = env->GetArrayLength(vars);
+    jlong *pVars;
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || pObj == 0) {
+        standard_exception(env);
+        return 0;
+    }
+    pVars = env->GetLongArrayElements(vars, NULL);
+    if (pVars == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    if (!abc2java_NtkVarsValid(pVars, NULL, nVars)) {
+        standard_exception(env);
+    } else {
+        try {
+            result = reinterpret_cast<jlong>(abc2java_NtkExists( pNtk, reinterpret_cast<Abc_Obj_t *>(pObj), pVars, nVars, nConfLimit ));
+        } catch (std::bad_alloc &ba) {
+             out_of_mem_exception(env);
+        }
+    }
+    env->ReleaseLongArrayElements(vars, pVars, JNI_ABORT);
+    return result;
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// CHOICES
+//////////////////////////////////////
+
+/*
+ * Choice classes are exported as one flat array over the node numbers
+ * (object ids) of the manager: { next[nObjs], repr[nObjs] }, where next
+ * is the following member of the node's class (-1 at the end or outside
+ * any class) and repr the literal 2 * reprId + fCompl of the class
+ * representative (-1 for representatives and nodes without choices).
+ * fCompl is set when the node is the complement of its representative.
+ * Classes start at the representative and follow next.
+ */
+
+/*
+ * A Fraig manager created with fChoicing records the nodes found
+ * equivalent to an existing one in the pNextE list of the representative.
+ * Phases come from the first random simulation pattern.
+ */
+static Vec_Int_t * abc2java_FraigChoiceArrays( Fraig_Man_t * fMan )
+{
+    Fraig_Node_t * pNode, * pTemp;
+    Vec_Int_t * vRes;
+    int i, nObjs = fMan->vNodes->nSize;
+
+    vRes = Vec_IntAlloc( 2 * nObjs );
+    Vec_IntFill( vRes, 2 * nObjs, -1 );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        pNode = fMan->vNodes->pArray[i];
+        if ( pNode->pRepr != NULL || pNode->pNextE == NULL )
+            continue;
+        for ( pTemp = pNode; pTemp->pNextE; pTemp = pTemp->pNextE )
+        {
+            Vec_IntWriteEntry( vRes, pTemp->Num, pTemp->pNextE->Num );
+            Vec_IntWriteEntry( vRes, nObjs + pTemp->pNextE->Num,
+                Abc_Var2Lit( pNode->Num, (pNode->puSimR[0] ^ pTemp->pNextE->puSimR[0]) & 1 ) );
+        }
+    }
+    return vRes;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Fraig_1ManChoiceArrays
+  (JNIEnv *env, jclass, jlong fAig) {
+    ABC2JAVA_TRACE_CALL();
+    jintArray result = NULL;
+
+    try {
+        result = convertToIntArray(env, abc2java_FraigChoiceArrays( reinterpret_cast<Fraig_Man_t *>(fAig) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+#ifndef ABC2JAVA_LEAN
+/*
+ * dch: rewriting snapshots of the network (unless fSynthesis is off)
+ * merged by SAT sweeping into a new strashed network with choices, as
+ * taken by Abc_NtkLutMap with fChoices.
+ */
+static Abc_Ntk_t * abc2java_NtkDch( Abc_Ntk_t * pNtk, int nConfLimit, int fSynthesis )
+{
+    Dch_Pars_t Pars;
+    Dch_ManSetDefaultParams( &Pars );
+    Pars.nBTLimit   = nConfLimit;
+    Pars.fSynthesis = fSynthesis;
+    Pars.fVerbose   = 0;
+    return Abc_NtkDch( pNtk, &Pars );
+}
+
+/*
+ * In a choice network the representative is the AND node with fanouts
+ * whose pData starts the list of its equivalent nodes; phases are the
+ * values under the all-zero CI assignment kept in fPhase.
+ */
+static Vec_Int_t * abc2java_NtkChoiceArrays( Abc_Ntk_t * pNtk )
+{
+    Abc_Obj_t * pObj, * pTemp, * pNext;
+    Vec_Int_t * vRes;
+    int i, nObjs = Abc_NtkObjNumMax(pNtk);
+
+    vRes = Vec_IntAlloc( 2 * nObjs );
+    Vec_IntFill( vRes, 2 * nObjs, -1 );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        if ( !Abc_AigNodeIsChoice(pObj) )
+            continue;
+        for ( pTemp = pObj; (pNext = (Abc_Obj_t *)pTemp->pData); pTemp = pNext )
+        {
+            Vec_IntWriteEntry( vRes, pTemp->Id, pNext->Id );
+            Vec_IntWriteEntry( vRes, nObjs + pNext->Id, Abc_Var2Lit( pObj->Id, pObj->fPhase ^ pNext->fPhase ) );
+        }
+    }
+    return vRes;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkDch
+  (JNIEnv *env, jclass, jlong pAig, jint nConfLimit, jboolean fSynthesis) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_NtkDch( pNtk, nConfLimit, fSynthesis ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkGetChoiceNum
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    return Abc_NtkGetChoiceNum( reinterpret_cast<Abc_Ntk_t *>(pAig) );
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkChoiceArrays
+  (JNIEnv *env, jclass, jlong pAig) {
+    ABC2JAVA_TRACE_CALL();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    jintArray result = NULL;
+
+    if (!Abc_NtkIsStrash(pNtk)) {
+        standard_exception(env);
+        return NULL;
+    }
+    try {
+        result = convertToIntArray(env, abc2java_NtkChoiceArrays( pNtk ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// WORKER POOL
+//////////////////////////////////////
+
+/*
+ * Out-of-process Gia engines. Most of ABC allocates with plain malloc and
+ * never reaches out_of_mem_exception, so an allocation failure or a crash
+ * inside an engine takes the whole JVM down. A pool runs the engines in
+ * worker processes instead: abc2java_worker, which is this file compiled
+ * with ABC2JAVA_WORKER (make worker), optionally under an address space
+ * limit.
+ *
+ * Jobs live in fixed-size slots of one shared memory segment mapped by
+ * the library and every worker: the input AIGs in the flat Gia array
+ * form, overwritten by the output arrays when the job is done. Each
+ * worker has a ring of slots to run and a ring of slots done, both single
+ * producer / single consumer, and a socket to the library on which one
+ * byte rings the doorbell in either direction. A supervisor thread waits
+ * on all sockets, completes jobs, and restarts a worker when its socket
+ * closes: the job it was running fails, the rest of its queue moves to
+ * the other workers. New jobs go to the live worker with the fewest jobs
+ * queued. A job may have a deadline: a worker still running it that long
+ * after starting it is killed and restarted the same way. Worker w is
+ * pinned like thread w of the other pools (Abc_SetThreadCpus, read when
+ * the pool starts) and keeps its cpu across restarts.
+ */
+#define ABC2JAVA_POOL_FRAIG        0
+#define ABC2JAVA_POOL_SCORR        1
+#define ABC2JAVA_POOL_CEC          2
+
+#define ABC2JAVA_POOL_WORKERS_MAX  64
+#define ABC2JAVA_POOL_SLOTS_MAX    256     // also the ring size
+
+#define ABC2JAVA_SLOT_FREE         0
+#define ABC2JAVA_SLOT_QUEUED       1
+#define ABC2JAVA_SLOT_DONE         2
+#define ABC2JAVA_SLOT_CRASHED      3
+#define ABC2JAVA_SLOT_KILLED       4
+
+// slack given to a cec job past its own time limit before it is killed
+#define ABC2JAVA_POOL_GRACE_MS     1000
+
+// descriptors of the socket and the segment in a worker
+#define ABC2JAVA_WORKER_SOCK_FD    3
+#define ABC2JAVA_WORKER_SHM_FD     4
+
+typedef struct abc2java_PoolRing_t_
+{
+    std::atomic<unsigned> Head;            // advanced by the consumer
+    std::atomic<unsigned> Tail;            // advanced by the producer
+    int              Entries[ABC2JAVA_POOL_SLOTS_MAX];
+} abc2java_PoolRing_t;
+
+typedef struct abc2java_PoolShm_t_
+{
+    int              nSlots;
+    int              nSlotInts;
+    abc2java_PoolRing_t Todo[ABC2JAVA_POOL_WORKERS_MAX];
+    abc2java_PoolRing_t Done[ABC2JAVA_POOL_WORKERS_MAX];
+    int              Place[ABC2JAVA_POOL_WORKERS_MAX][ABC2JAVA_PLACE_INTS]; // written by the workers
+} abc2java_PoolShm_t;
+
+// followed by nSlotInts ints of data
+typedef struct abc2java_PoolSlot_t_
+{
+    int              Engine;
+    int              nConfLimit;
+    int              nTimeLimit;
+    int              nKillMs;              // deadline after the start, 0 for none
+    std::atomic<long long> StartMs;        // when the worker took it, 0 before
+    int              nIn;                  // input ints
+    int              nOut;                 // output ints, -1 if they did not fit
+    int              Result;
+} abc2java_PoolSlot_t;
+
+static inline size_t abc2java_PoolSlotBytes( int nSlotInts )
+{
+    return (sizeof(abc2java_PoolSlot_t) + sizeof(int) * (size_t)nSlotInts + 7) & ~(size_t)7;
+}
+
+static inline abc2java_PoolSlot_t * abc2java_PoolSlot( abc2java_PoolShm_t * pShm, int iSlot )
+{
+    return (abc2java_PoolSlot_t *)((char *)pShm + ((sizeof(abc2java_PoolShm_t) + 7) & ~(size_t)7)
+                                   + abc2java_PoolSlotBytes(pShm->nSlotInts) * iSlot);
+}
+
+static inline int * abc2java_PoolSlotData( abc2java_PoolSlot_t * pSlot )
+{
+    return (int *)(pSlot + 1);
+}
+
+static inline long long abc2java_PoolNowMs()
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static inline void abc2java_PoolRingPush( abc2java_PoolRing_t * pRing, int Entry )
+{
+    unsigned Tail = pRing->Tail.load( std::memory_order_relaxed );
+    pRing->Entries[Tail % ABC2JAVA_POOL_SLOTS_MAX] = Entry;
+    pRing->Tail.store( Tail + 1, std::memory_order_release );
+}
+
+/*
+ * Length of the Gia arrays record at pIn, -1 if it does not fit in nIn
+ * ints or is not well formed.
+ */
+static int abc2java_PoolRecordLen( const int * pIn, int nIn )
+{
+    int nLen;
+    if ( nIn < 4 || pIn[2] < 0 || pIn[3] < 0 || pIn[2] > (nIn - 4) / 2 )
+        return -1;
+    nLen = 4 + 2 * pIn[2] + pIn[3];
+    if ( nLen > nIn || !abc2java_GiaArraysValid( pIn[0], pIn[1], pIn + 4, pIn[2], pIn + 4 + 2 * pIn[2], pIn[3] ) )
+        return -1;
+    return nLen;
+}
+
+static Gia_Man_t * abc2java_PoolRecordToGia( const int * pIn )
+{
+    return abc2java_GiaFromArrays( pIn[0], pIn[1], pIn + 4, pIn[2], pIn + 4 + 2 * pIn[2], pIn[3] );
+}
+
+#ifdef ABC2JAVA_WORKER
+/*
+ * Runs the job in a slot; the input was written by abc2java_GiaToArrays
+ * in the library.
+ */
+static void abc2java_WorkerRun( abc2java_PoolShm_t * pShm, int iSlot )
+{
+    abc2java_PoolSlot_t * pSlot = abc2java_PoolSlot( pShm, iSlot );
+    int * pData = abc2java_PoolSlotData( pSlot );
+    Gia_Man_t * pGia, * pGia2, * pRes = NULL;
+    Vec_Int_t * vOut;
+
+    pGia = abc2java_PoolRecordToGia( pData );
+    pSlot->nOut = 0;
+    if ( pSlot->Engine == ABC2JAVA_POOL_CEC )
+    {
+        pGia2 = abc2java_PoolRecordToGia( pData + abc2java_PoolRecordLen(pData, pSlot->nIn) );
+        pSlot->Result = abc2java_GiaCec( pGia, pGia2, pSlot->nConfLimit, pSlot->nTimeLimit );
+        Gia_ManStop( pGia2 );
+    }
+    else
+    {
+        if ( pSlot->Engine == ABC2JAVA_POOL_FRAIG )
+            pRes = abc2java_GiaFraig( pGia, pSlot->nConfLimit );
+        else
+            pRes = abc2java_GiaScorr( pGia, pSlot->nConfLimit );
+        vOut = abc2java_GiaToArrays( pRes );
+        pSlot->Result = Vec_IntSize(vOut) <= pShm->nSlotInts;
+        pSlot->nOut = pSlot->Result ? Vec_IntSize(vOut) : -1;
+        if ( pSlot->Result )
+            memcpy( pData, Vec_IntArray(vOut), sizeof(int) * Vec_IntSize(vOut) );
+        Vec_IntFree( vOut );
+        Gia_ManStop( pRes );
+    }
+    Gia_ManStop( pGia );
+}
+
+/*
+ * abc2java_worker <memory limit in MB, 0 for none> <worker index> <cpu,
+ * empty for none>, with the socket and the segment set up by
+ * abc2java_PoolSpawn. The worker pins itself before it allocates. Runs the jobs
+ * of its ring on every doorbell and exits when the library goes away.
+ * Starting a job with a deadline rings the library, whose supervisor
+ * then times it.
+ */
+int main( int argc, char ** argv )
+{
+    abc2java_PoolShm_t * pShm;
+    abc2java_PoolRing_t * pTodo, * pDone;
+    struct rlimit Limit;
+    struct stat St;
+    abc2java_PoolSlot_t * pSlot;
+    unsigned Head;
+    char Buf[64];
+    int iWorker, nMemLimitMb, Cpu, Place[ABC2JAVA_PLACE_INTS];
+
+    if ( argc != 4 )
+    {
+        fprintf( stderr, "abc2java_worker is started by Abc_PoolStart\n" );
+        return 1;
+    }
+    nMemLimitMb = atoi( argv[1] );
+    iWorker = atoi( argv[2] );
+    Cpu = atoi( argv[3] );
+    abc2java_ThreadPlace( &Cpu, argv[3][0] ? 1 : 0, 0, Place );
+    if ( nMemLimitMb > 0 )
+    {
+        Limit.rlim_cur = Limit.rlim_max = (rlim_t)nMemLimitMb << 20;
+        setrlimit( RLIMIT_AS, &Limit );
+    }
+    if ( iWorker < 0 || iWorker >= ABC2JAVA_POOL_WORKERS_MAX || fstat( ABC2JAVA_WORKER_SHM_FD, &St ) != 0 )
+        return 1;
+    pShm = (abc2java_PoolShm_t *)mmap( NULL, St.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, ABC2JAVA_WORKER_SHM_FD, 0 );
+    if ( pShm == MAP_FAILED )
+        return 1;
+    memcpy( pShm->Place[iWorker], Place, sizeof(Place) );
+    abc2java_StartLean();
+    pTodo = &pShm->Todo[iWorker];
+    pDone = &pShm->Done[iWorker];
+    while ( read( ABC2JAVA_WORKER_SOCK_FD, Buf, sizeof(Buf) ) > 0 )
+    {
+        Head = pTodo->Head.load( std::memory_order_relaxed );
+        while ( Head != pTodo->Tail.load( std::memory_order_acquire ) )
+        {
+            pSlot = abc2java_PoolSlot( pShm, pTodo->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX] );
+            pSlot->StartMs.store( abc2java_PoolNowMs(), std::memory_order_release );
+            if ( pSlot->nKillMs > 0 && write( ABC2JAVA_WORKER_SOCK_FD, Buf, 1 ) != 1 )
+                return 0;
+            abc2java_WorkerRun( pShm, pTodo->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX] );
+            abc2java_PoolRingPush( pDone, pTodo->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX] );
+            pTodo->Head.store( ++Head, std::memory_order_release );
+        }
+        if ( write( ABC2JAVA_WORKER_SOCK_FD, Buf, 1 ) != 1 )
+            break;
+    }
+    return 0;
+}
+#else
+
+extern char ** environ;
+
+typedef struct abc2java_PoolWorker_t_
+{
+    pid_t            Pid;                  // -1 if it could not be restarted
+    int              Fd;                   // library end of the socket
+    int              nQueued;
+} abc2java_PoolWorker_t;
+
+typedef struct abc2java_Pool_t_
+{
+    char *           pPath;
+    int              nWorkers;
+    int              nMemLimitMb;
+    int *            pCpus;                // worker w on pCpus[w % nCpus]
+    int              nCpus;
+    int              ShmFd;
+    size_t           nShmBytes;
+    abc2java_PoolShm_t * pShm;
+    abc2java_PoolWorker_t Workers[ABC2JAVA_POOL_WORKERS_MAX];
+    int *            pSlotState;
+    int *            pSlotWorker;
+    int              nRestarts;
+    int              fStop;
+    int              WakeFds[2];           // wakes the supervisor to stop
+    pthread_t        Supervisor;
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+} abc2java_Pool_t;
+
+/*
+ * The socket and the segment are first copied above the worker's
+ * descriptors, so that neither dup2 clobbers the source of the other
+ * (the segment may well be descriptor 3 in the library).
+ */
+static int abc2java_PoolSpawn( abc2java_Pool_t * p, int w )
+{
+    posix_spawn_file_actions_t Actions;
+    char Limit[16], Index[16], Cpu[16];
+    char * pArgv[5] = { p->pPath, Limit, Index, Cpu, NULL };
+    int Fds[2], SockFd, ShmFd, Status;
+
+    p->Workers[w].Pid = -1;
+    p->Workers[w].Fd = -1;
+    p->Workers[w].nQueued = 0;
+    p->pShm->Todo[w].Head = p->pShm->Todo[w].Tail = 0;
+    p->pShm->Done[w].Head = p->pShm->Done[w].Tail = 0;
+    p->pShm->Place[w][0] = p->pShm->Place[w][1] = -1;
+    p->pShm->Place[w][2] = 0;
+    if ( socketpair( AF_UNIX, SOCK_STREAM, 0, Fds ) != 0 )
+        return 0;
+    fcntl( Fds[0], F_SETFD, FD_CLOEXEC );
+    SockFd = fcntl( Fds[1], F_DUPFD_CLOEXEC, ABC2JAVA_WORKER_SHM_FD + 1 );
+    ShmFd = fcntl( p->ShmFd, F_DUPFD_CLOEXEC, ABC2JAVA_WORKER_SHM_FD + 1 );
+    close( Fds[1] );
+    if ( SockFd < 0 || ShmFd < 0 )
+    {
+        if ( SockFd >= 0 )
+            close( SockFd );
+        if ( ShmFd >= 0 )
+            close( ShmFd );
+        close( Fds[0] );
+        return 0;
+    }
+    snprintf( Limit, sizeof(Limit), "%d", p->nMemLimitMb );
+    snprintf( Index, sizeof(Index), "%d", w );
+    Cpu[0] = 0;
+    if ( p->nCpus > 0 )
+        snprintf( Cpu, sizeof(Cpu), "%d", p->pCpus[w % p->nCpus] );
+    posix_spawn_file_actions_init( &Actions );
+    posix_spawn_file_actions_adddup2( &Actions, SockFd, ABC2JAVA_WORKER_SOCK_FD );
+    posix_spawn_file_actions_adddup2( &Actions, ShmFd, ABC2JAVA_WORKER_SHM_FD );
+    Status = posix_spawn( &p->Workers[w].Pid, p->pPath, &Actions, NULL, pArgv, environ );
+    posix_spawn_file_actions_destroy( &Actions );
+    close( SockFd );
+    close( ShmFd );
+    if ( Status != 0 )
+    {
+        p->Workers[w].Pid = -1;
+        close( Fds[0] );
+        return 0;
+    }
+    p->Workers[w].Fd = Fds[0];
+    return 1;
+}
+
+static void abc2java_PoolDoorbell( int Fd )
+{
+#ifdef MSG_NOSIGNAL
+    send( Fd, "", 1, MSG_NOSIGNAL );
+#else
+    send( Fd, "", 1, 0 );
+#endif
+}
+
+// queues a job on the least loaded live worker; fails it if there is none
+static void abc2java_PoolEnqueue( abc2java_Pool_t * p, int iSlot )
+{
+    int w, wBest = -1;
+
+    for ( w = 0; w < p->nWorkers; w++ )
+        if ( p->Workers[w].Pid > 0 && (wBest < 0 || p->Workers[w].nQueued < p->Workers[wBest].nQueued) )
+            wBest = w;
+    if ( wBest < 0 )
+    {
+        p->pSlotState[iSlot] = ABC2JAVA_SLOT_CRASHED;
+        pthread_cond_broadcast( &p->Cond );
+        return;
+    }
+    p->pSlotState[iSlot] = ABC2JAVA_SLOT_QUEUED;
+    p->pSlotWorker[iSlot] = wBest;
+    p->Workers[wBest].nQueued++;
+    abc2java_PoolRingPush( &p->pShm->Todo[wBest], iSlot );
+    abc2java_PoolDoorbell( p->Workers[wBest].Fd );
+}
+
+static void abc2java_PoolComplete( abc2java_Pool_t * p, int w )
+{
+    abc2java_PoolRing_t * pDone = &p->pShm->Done[w];
+    unsigned Head = pDone->Head.load( std::memory_order_relaxed );
+
+    while ( Head != pDone->Tail.load( std::memory_order_acquire ) )
+    {
+        p->pSlotState[pDone->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX]] = ABC2JAVA_SLOT_DONE;
+        p->Workers[w].nQueued--;
+        pDone->Head.store( ++Head, std::memory_order_release );
+    }
+    pthread_cond_broadcast( &p->Cond );
+}
+
+/*
+ * The worker's socket closed, or it ran past the deadline of job iKill
+ * (-1 otherwise). The job it died on, iKill or else the first one of its
+ * ring that is not done, fails; the others are queued again after the
+ * restart.
+ */
+static void abc2java_PoolRestart( abc2java_Pool_t * p, int w, int iKill )
+{
+    abc2java_PoolRing_t * pTodo = &p->pShm->Todo[w];
+    Vec_Int_t * vRequeue = Vec_IntAlloc( 16 );
+    unsigned Head, Tail;
+    int iSlot, i, fFailed = 0;
+
+    close( p->Workers[w].Fd );
+    kill( p->Workers[w].Pid, SIGKILL );
+    waitpid( p->Workers[w].Pid, NULL, 0 );
+    abc2java_PoolComplete( p, w );
+    Tail = pTodo->Tail.load( std::memory_order_relaxed );
+    for ( Head = pTodo->Head.load( std::memory_order_acquire ); Head != Tail; Head++ )
+    {
+        iSlot = pTodo->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX];
+        if ( p->pSlotState[iSlot] != ABC2JAVA_SLOT_QUEUED )
+            continue;
+        if ( iKill >= 0 ? iSlot == iKill : !fFailed )
+            p->pSlotState[iSlot] = iKill >= 0 ? ABC2JAVA_SLOT_KILLED : ABC2JAVA_SLOT_CRASHED;
+        else
+            Vec_IntPush( vRequeue, iSlot );
+        fFailed = 1;
+    }
+    p->nRestarts++;
+    abc2java_PoolSpawn( p, w );
+    Vec_IntForEachEntry( vRequeue, iSlot, i )
+        abc2java_PoolEnqueue( p, iSlot );
+    Vec_IntFree( vRequeue );
+    pthread_cond_broadcast( &p->Cond );
+}
+
+/*
+ * Kills the workers running a job past its deadline. Returns the time in
+ * ms to the next deadline of a running job, -1 if there is none.
+ */
+static int abc2java_PoolCheckDeadlines( abc2java_Pool_t * p )
+{
+    abc2java_PoolRing_t * pTodo;
+    abc2java_PoolSlot_t * pSlot;
+    long long Now, Start, nLeft, nNext = -1;
+    unsigned Head;
+    int w, iSlot;
+
+    for ( w = 0; w < p->nWorkers; w++ )
+    {
+        if ( p->Workers[w].Pid <= 0 )
+            continue;
+        pTodo = &p->pShm->Todo[w];
+        Head = pTodo->Head.load( std::memory_order_acquire );
+        if ( Head == pTodo->Tail.load( std::memory_order_relaxed ) )
+            continue;
+        iSlot = pTodo->Entries[Head % ABC2JAVA_POOL_SLOTS_MAX];
+        pSlot = abc2java_PoolSlot( p->pShm, iSlot );
+        Start = pSlot->StartMs.load( std::memory_order_acquire );
+        if ( p->pSlotState[iSlot] != ABC2JAVA_SLOT_QUEUED || p->pSlotWorker[iSlot] != w || pSlot->nKillMs <= 0 || Start == 0 )
+            continue;
+        Now = abc2java_PoolNowMs();
+        nLeft = Start + pSlot->nKillMs - Now;
+        if ( nLeft <= 0 )
+            abc2java_PoolRestart( p, w, iSlot );
+        else if ( nNext < 0 || nLeft < nNext )
+            nNext = nLeft;
+    }
+    return (int)nNext;
+}
+
+static void * abc2java_PoolSupervisor( void * pArg )
+{
+    abc2java_Pool_t * p = (abc2java_Pool_t *)pArg;
+    struct pollfd Fds[ABC2JAVA_POOL_WORKERS_MAX + 1];
+    int Workers[ABC2JAVA_POOL_WORKERS_MAX + 1];
+    char Buf[64];
+    int w, i, nFds, nTimeOut;
+    ssize_t nRead;
+
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        nTimeOut = abc2java_PoolCheckDeadlines( p );
+        Fds[0].fd = p->WakeFds[0];
+        Fds[0].events = POLLIN;
+        nFds = 1;
+        for ( w = 0; w < p->nWorkers; w++ )
+            if ( p->Workers[w].Pid > 0 )
+            {
+                Fds[nFds].fd = p->Workers[w].Fd;
+                Fds[nFds].events = POLLIN;
+                Workers[nFds++] = w;
+            }
+        pthread_mutex_unlock( &p->Mutex );
+
+        if ( poll( Fds, nFds, nTimeOut ) < 0 && errno != EINTR )
+            break;
+        pthread_mutex_lock( &p->Mutex );
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        for ( i = 1; i < nFds; i++ )
+        {
+            if ( Fds[i].revents == 0 )
+                continue;
+            nRead = (Fds[i].revents & POLLIN) ? read( Fds[i].fd, Buf, sizeof(Buf) ) : 0;
+            if ( nRead > 0 )
+                abc2java_PoolComplete( p, Workers[i] );
+            else if ( nRead == 0 || errno != EINTR )
+                abc2java_PoolRestart( p, Workers[i], -1 );
+        }
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+static void abc2java_PoolFree( abc2java_Pool_t * p )
+{
+    int w;
+
+    for ( w = 0; w < p->nWorkers; w++ )
+        if ( p->Workers[w].Pid > 0 )
+        {
+            close( p->Workers[w].Fd );
+            kill( p->Workers[w].Pid, SIGKILL );
+            waitpid( p->Workers[w].Pid, NULL, 0 );
+        }
+    if ( p->pShm )
+        munmap( p->pShm, p->nShmBytes );
+    if ( p->ShmFd >= 0 )
+        close( p->ShmFd );
+    close( p->WakeFds[0] );
+    close( p->WakeFds[1] );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    ABC_FREE( p->pSlotState );
+    ABC_FREE( p->pSlotWorker );
+    ABC_FREE( p->pCpus );
+    ABC_FREE( p->pPath );
+    ABC_FREE( p );
+}
+
+/*
+ * The segment is unlinked right away; workers get it as a descriptor,
+ * so it goes away with the last process that maps it.
+ */
+static abc2java_Pool_t * abc2java_PoolStart( const char * pPath, int nWorkers, int nSlots, int nSlotInts, int nMemLimitMb )
+{
+    static std::atomic<int> Counter( 0 );
+    abc2java_Pool_t * p;
+    char Name[64];
+    int w;
+
+    p = ABC_CALLOC( abc2java_Pool_t, 1 );
+    p->pPath       = Abc_UtilStrsav( (char *)pPath );
+    p->nWorkers    = nWorkers;
+    p->nMemLimitMb = nMemLimitMb;
+    p->pCpus       = abc2java_CpusRead( &p->nCpus );
+    p->pSlotState  = ABC_CALLOC( int, nSlots );
+    p->pSlotWorker = ABC_FALLOC( int, nSlots );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    p->WakeFds[0] = p->WakeFds[1] = -1;
+    if ( pipe( p->WakeFds ) != 0 )
+        p->WakeFds[0] = p->WakeFds[1] = -1;
+    fcntl( p->WakeFds[0], F_SETFD, FD_CLOEXEC );
+    fcntl( p->WakeFds[1], F_SETFD, FD_CLOEXEC );
+
+    snprintf( Name, sizeof(Name), "/abc2java.%d.%d", (int)getpid(), Counter++ );
+    p->ShmFd = shm_open( Name, O_RDWR | O_CREAT | O_EXCL, 0600 );
+    if ( p->ShmFd >= 0 )
+        shm_unlink( Name );
+    p->nShmBytes = ((sizeof(abc2java_PoolShm_t) + 7) & ~(size_t)7) + abc2java_PoolSlotBytes(nSlotInts) * nSlots;
+    if ( p->WakeFds[0] < 0 || p->ShmFd < 0 || ftruncate( p->ShmFd, p->nShmBytes ) != 0 )
+    {
+        abc2java_PoolFree( p );
+        return NULL;
+    }
+    p->pShm = (abc2java_PoolShm_t *)mmap( NULL, p->nShmBytes, PROT_READ | PROT_WRITE, MAP_SHARED, p->ShmFd, 0 );
+    if ( p->pShm == MAP_FAILED )
+    {
+        p->pShm = NULL;
+        abc2java_PoolFree( p );
+        return NULL;
+    }
+    p->pShm->nSlots = nSlots;
+    p->pShm->nSlotInts = nSlotInts;
+    for ( w = 0; w < nWorkers; w++ )
+        if ( !abc2java_PoolSpawn( p, w ) )
+        {
+            abc2java_PoolFree( p );
+            return NULL;
+        }
+    if ( pthread_create( &p->Supervisor, NULL, abc2java_PoolSupervisor, p ) != 0 )
+    {
+        abc2java_PoolFree( p );
+        return NULL;
+    }
+    return p;
+}
+
+static void abc2java_PoolStop( abc2java_Pool_t * p )
+{
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_mutex_unlock( &p->Mutex );
+    while ( write( p->WakeFds[1], "", 1 ) < 0 && errno == EINTR )
+        ;
+    pthread_join( p->Supervisor, NULL );
+    abc2java_PoolFree( p );
+}
+
+/*
+ * Writes the Gia arrays of pA (and pB for cec) into a free slot and
+ * queues the job, whose worker is killed nKillMs after starting it (0 for
+ * never). Returns the slot, -1 if none is free or the input does not fit.
+ */
+static int abc2java_PoolSubmit( abc2java_Pool_t * p, int Engine, Gia_Man_t * pA, Gia_Man_t * pB, int nConfLimit, int nTimeLimit, int nKillMs )
+{
+    abc2java_PoolSlot_t * pSlot;
+    Vec_Int_t * vA, * vB = NULL;
+    int iSlot, nIn;
+
+    vA = abc2java_GiaToArrays( pA );
+    if ( pB )
+        vB = abc2java_GiaToArrays( pB );
+    nIn = Vec_IntSize(vA) + (vB ? Vec_IntSize(vB) : 0);
+    pthread_mutex_lock( &p->Mutex );
+    for ( iSlot = 0; iSlot < p->pShm->nSlots; iSlot++ )
+        if ( p->pSlotState[iSlot] == ABC2JAVA_SLOT_FREE )
+            break;
+    if ( iSlot == p->pShm->nSlots || nIn > p->pShm->nSlotInts )
+        iSlot = -1;
+    else
+    {
+        pSlot = abc2java_PoolSlot( p->pShm, iSlot );
+        pSlot->Engine     = Engine;
+        pSlot->nConfLimit = nConfLimit;
+        pSlot->nTimeLimit = nTimeLimit;
+        pSlot->nKillMs    = nKillMs;
+        pSlot->StartMs.store( 0, std::memory_order_relaxed );
+        pSlot->nIn        = nIn;
+        pSlot->nOut       = -1;
+        pSlot->Result     = -1;
+        memcpy( abc2java_PoolSlotData(pSlot), Vec_IntArray(vA), sizeof(int) * Vec_IntSize(vA) );
+        if ( vB )
+            memcpy( abc2java_PoolSlotData(pSlot) + Vec_IntSize(vA), Vec_IntArray(vB), sizeof(int) * Vec_IntSize(vB) );
+        abc2java_PoolEnqueue( p, iSlot );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    Vec_IntFree( vA );
+    if ( vB )
+        Vec_IntFree( vB );
+    return iSlot;
+}
+
+/*
+ * 1 when the job is done, -1 if its worker crashed on it, -3 if it was
+ * killed at its deadline, 0 if it is still queued after nTimeOutMs (< 0
+ * waits for good), -2 if the slot holds no job.
+ */
+static int abc2java_PoolWait( abc2java_Pool_t * p, int iSlot, int nTimeOutMs )
+{
+    struct timespec Deadline;
+    int State;
+
+    clock_gettime( CLOCK_REALTIME, &Deadline );
+    Deadline.tv_sec  += nTimeOutMs / 1000;
+    Deadline.tv_nsec += (long)(nTimeOutMs % 1000) * 1000000;
+    if ( Deadline.tv_nsec >= 1000000000 )
+    {
+        Deadline.tv_sec++;
+        Deadline.tv_nsec -= 1000000000;
+    }
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->pSlotState[iSlot] == ABC2JAVA_SLOT_QUEUED )
+    {
+        if ( nTimeOutMs < 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        else if ( pthread_cond_timedwait( &p->Cond, &p->Mutex, &Deadline ) == ETIMEDOUT )
+            break;
+    }
+    State = p->pSlotState[iSlot];
+    pthread_mutex_unlock( &p->Mutex );
+    if ( State == ABC2JAVA_SLOT_FREE )
+        return -2;
+    if ( State == ABC2JAVA_SLOT_KILLED )
+        return -3;
+    return State == ABC2JAVA_SLOT_DONE ? 1 : State == ABC2JAVA_SLOT_CRASHED ? -1 : 0;
+}
+
+// the slot of a finished job, NULL if it is free or still queued
+static abc2java_PoolSlot_t * abc2java_PoolFinished( abc2java_Pool_t * p, int iSlot )
+{
+    int State;
+
+    if ( iSlot < 0 || iSlot >= p->pShm->nSlots )
+        return NULL;
+    pthread_mutex_lock( &p->Mutex );
+    State = p->pSlotState[iSlot];
+    pthread_mutex_unlock( &p->Mutex );
+    return State == ABC2JAVA_SLOT_DONE ? abc2java_PoolSlot( p->pShm, iSlot ) : NULL;
+}
+
+static int abc2java_PoolRelease( abc2java_Pool_t * p, int iSlot )
+{
+    int fReleased = 0;
+
+    if ( iSlot < 0 || iSlot >= p->pShm->nSlots )
+        return 0;
+    pthread_mutex_lock( &p->Mutex );
+    if ( p->pSlotState[iSlot] == ABC2JAVA_SLOT_DONE || p->pSlotState[iSlot] == ABC2JAVA_SLOT_CRASHED || p->pSlotState[iSlot] == ABC2JAVA_SLOT_KILLED )
+    {
+        p->pSlotState[iSlot] = ABC2JAVA_SLOT_FREE;
+        fReleased = 1;
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return fReleased;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolStart
+  (JNIEnv *env, jclass, jstring workerPath, jint nWorkers, jint nSlots, jint nSlotInts, jint nMemLimitMb) {
+    ABC2JAVA_TRACE_TIMED();
+    const char *pPath;
+    jlong result = 0;
+
+    if (nWorkers < 1 || nWorkers > ABC2JAVA_POOL_WORKERS_MAX || nSlots < 1 || nSlots > ABC2JAVA_POOL_SLOTS_MAX || nSlotInts < 8) {
+        standard_exception(env);
+        return 0;
+    }
+    pPath = env->GetStringUTFChars(workerPath, NULL);
+    if (pPath == NULL) {
+        out_of_mem_exception(env);
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_PoolStart( pPath, nWorkers, nSlots, nSlotInts, nMemLimitMb ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    env->ReleaseStringUTFChars(workerPath, pPath);
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolStop
+  (JNIEnv *env, jclass, jlong pPool) {
+    ABC2JAVA_TRACE_TIMED();
+    abc2java_PoolStop( reinterpret_cast<abc2java_Pool_t *>(pPool) );
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolSubmitFraig
+  (JNIEnv *env, jclass, jlong pPool, jlong gAig, jint nConfLimit, jint nTimeOutMs) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+
+    try {
+        result = abc2java_PoolSubmit( reinterpret_cast<abc2java_Pool_t *>(pPool), ABC2JAVA_POOL_FRAIG,
+                                      reinterpret_cast<Gia_Man_t *>(gAig), NULL, nConfLimit, 0, std::max(nTimeOutMs, 0) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolSubmitScorr
+  (JNIEnv *env, jclass, jlong pPool, jlong gAig, jint nConfLimit, jint nTimeOutMs) {
+    ABC2JAVA_TRACE_CALL();
+    jint result = -1;
+
+    try {
+        result = abc2java_PoolSubmit( reinterpret_cast<abc2java_Pool_t *>(pPool), ABC2JAVA_POOL_SCORR,
+                                      reinterpret_cast<Gia_Man_t *>(gAig), NULL, nConfLimit, 0, std::max(nTimeOutMs, 0) );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolSubmitCec
+  (JNIEnv *env, jclass, jlong pPool, jlong gAigA, jlong gAigB, jint nConfLimit, jint nTimeLimit) {
+    ABC2JAVA_TRACE_CALL();
+    Gia_Man_t *pA = reinterpret_cast<Gia_Man_t *>(gAigA);
+    Gia_Man_t *pB = reinterpret_cast<Gia_Man_t *>(gAigB);
+    jint result = -1;
+
+    if (Gia_ManCiNum(pA) != Gia_ManCiNum(pB) || Gia_ManCoNum(pA) != Gia_ManCoNum(pB)) {
+        standard_exception(env);
+        return -1;
+    }
+    try {
+        result = abc2java_PoolSubmit( reinterpret_cast<abc2java_Pool_t *>(pPool), ABC2JAVA_POOL_CEC,
+                                      pA, pB, nConfLimit, nTimeLimit,
+                                      nTimeLimit > 0 ? std::min(nTimeLimit, 1000000) * 1000 + ABC2JAVA_POOL_GRACE_MS : 0 );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolWait
+  (JNIEnv *env, jclass, jlong pPool, jint job, jint nTimeOutMs) {
+    ABC2JAVA_TRACE_TIMED();
+    abc2java_Pool_t *p = reinterpret_cast<abc2java_Pool_t *>(pPool);
+    jint result = -2;
+
+    if (job >= 0 && job < p->pShm->nSlots) {
+        result = abc2java_PoolWait( p, job, nTimeOutMs );
+    }
+    if (result == -2) {
+        standard_exception(env);
+        return -1;
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolResult
+  (JNIEnv *env, jclass, jlong pPool, jint job) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_PoolSlot_t *pSlot = abc2java_PoolFinished( reinterpret_cast<abc2java_Pool_t *>(pPool), job );
+
+    if (pSlot == NULL) {
+        standard_exception(env);
+        return -1;
+    }
+    return pSlot->Result;
+}
+
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolResultArrays
+  (JNIEnv *env, jclass, jlong pPool, jint job) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_PoolSlot_t *pSlot = abc2java_PoolFinished( reinterpret_cast<abc2java_Pool_t *>(pPool), job );
+    jintArray result;
+
+    if (pSlot == NULL) {
+        standard_exception(env);
+        return NULL;
+    }
+    if (pSlot->nOut <= 0) {
+        return NULL;
+    }
+    result = env->NewIntArray(pSlot->nOut);
+    if (result == NULL) {
+        out_of_mem_exception(env);
+    } else {
+        env->SetIntArrayRegion(result, 0, pSlot->nOut, abc2java_PoolSlotData(pSlot));
+    }
+    return result;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolResultGia
+  (JNIEnv *env, jclass, jlong pPool, jint job) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_PoolSlot_t *pSlot = abc2java_PoolFinished( reinterpret_cast<abc2java_Pool_t *>(pPool), job );
+    jlong result = 0;
+
+    if (pSlot == NULL) {
+        standard_exception(env);
+        return 0;
+    }
+    // the output comes from another process, so it is checked again
+    if (pSlot->nOut <= 0 || abc2java_PoolRecordLen(abc2java_PoolSlotData(pSlot), pSlot->nOut) < 0) {
+        return 0;
+    }
+    try {
+        result = reinterpret_cast<jlong>(abc2java_GiaHashed( abc2java_PoolRecordToGia(abc2java_PoolSlotData(pSlot)) ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolRelease
+  (JNIEnv *env, jclass, jlong pPool, jint job) {
+    ABC2JAVA_TRACE_CALL();
+    if (!abc2java_PoolRelease( reinterpret_cast<abc2java_Pool_t *>(pPool), job )) {
+        standard_exception(env);
+    }
+}
+
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolRestarts
+  (JNIEnv *env, jclass, jlong pPool) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_Pool_t *p = reinterpret_cast<abc2java_Pool_t *>(pPool);
+    jint result;
+
+    pthread_mutex_lock( &p->Mutex );
+    result = p->nRestarts;
+    pthread_mutex_unlock( &p->Mutex );
+    return result;
+}
+
+/*
+ * { cpu, node, status } per worker, as each reported it when it came up
+ * ({ -1, -1, 0 } until then).
+ */
+JNIEXPORT jintArray JNICALL Java_com_berkeley_abc_Abc_Abc_1PoolReadPlacement
+  (JNIEnv *env, jclass, jlong pPool) {
+    ABC2JAVA_TRACE_CALL();
+    abc2java_Pool_t *p = reinterpret_cast<abc2java_Pool_t *>(pPool);
+    jintArray result = NULL;
+
+    try {
+        result = convertToIntArray(env, Vec_IntAllocArrayCopy( &p->pShm->Place[0][0], ABC2JAVA_PLACE_INTS * p->nWorkers ));
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif /* ABC2JAVA_WORKER */
+
+
+#ifndef ABC2JAVA_LEAN
+//////////////////////////////////////
+// DON'T-CARE OPTIMIZATION
+//////////////////////////////////////
+
+/*
+ * mfs: windowed resubstitution and redundancy removal with don't-cares
+ * computed by simulation and SAT, run on a logic network derived from
+ * the AIG and strashed back. mfs itself is sequential and has no time
+ * limit, so a combinational network is split into output partitions
+ * (abc2java_NtkPartitionOutputs, four per thread) that nThreads threads
+ * optimize independently; the partitions not started within nTimeOutMs
+ * stay as they are. A partition that has started runs to the end, so the
+ * budget can be overrun by the slowest partition; with a budget, each SAT
+ * call keeps a conflict limit (mfs's default if nConfLimit is not
+ * positive). The cones are merged back into one strashed network by
+ * structural hashing. Networks with latches are optimized as one
+ * partition, which always runs to the end. The input is left untouched,
+ * and the result is never larger than it.
+ */
+typedef struct abc2java_Mfs_t_
+{
+    Mfs_Par_t        Pars;
+    Abc_Ntk_t **     pParts;         // cones in, optimized cones out
+    int              nParts;
+    int              nNext;          // next partition to take
+    int              nDone;          // partitions optimized
+    struct timespec  Deadline;
+    int              fDeadline;
+    pthread_mutex_t  Mutex;
+    int *            pCpus;          // placement (see THREAD PLACEMENT)
+    int              nCpus;
+    int              nThreads;       // threads that started so far
+    int *            pPlacement;     // ABC2JAVA_PLACE_INTS per thread
+} abc2java_Mfs_t;
+
+static Abc_Ntk_t * abc2java_NtkMfsOne( Abc_Ntk_t * pNtk, Mfs_Par_t * pPars )
+{
+    Abc_Ntk_t * pLogic, * pRes;
+    Mfs_Par_t Pars = *pPars;
+
+    pLogic = Abc_NtkToLogic( pNtk );
+    if ( !Abc_NtkMfs( pLogic, &Pars ) )
+    {
+        Abc_NtkDelete( pLogic );
+        return Abc_NtkDup( pNtk );
+    }
+    pRes = Abc_NtkStrash( pLogic, 0, 1, 0 );
+    Abc_NtkDelete( pLogic );
+    if ( Abc_NtkNodeNum(pRes) < Abc_NtkNodeNum(pNtk) )
+        return pRes;
+    Abc_NtkDelete( pRes );
+    return Abc_NtkDup( pNtk );
+}
+
+static void * abc2java_NtkMfsWorker( void * pArg )
+{
+    abc2java_Mfs_t * p = (abc2java_Mfs_t *)pArg;
+    Abc_Ntk_t * pRes;
+    struct timespec Now;
+    int i;
+
+    // pinned before it takes a partition, so the logic network, the
+    // windows and the SAT solver of mfs are allocated node-local
+    pthread_mutex_lock( &p->Mutex );
+    i = p->nThreads++;
+    pthread_mutex_unlock( &p->Mutex );
+    abc2java_ThreadPlace( p->pCpus, p->nCpus, i, p->pPlacement + ABC2JAVA_PLACE_INTS * i );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        i = p->nNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( i >= p->nParts )
+            break;
+        if ( p->fDeadline )
+        {
+            clock_gettime( CLOCK_MONOTONIC, &Now );
+            if ( Now.tv_sec > p->Deadline.tv_sec || (Now.tv_sec == p->Deadline.tv_sec && Now.tv_nsec >= p->Deadline.tv_nsec) )
+                continue;
+        }
+        pRes = abc2java_NtkMfsOne( p->pParts[i], &p->Pars );
+        Abc_NtkDelete( p->pParts[i] );
+        p->pParts[i] = pRes;
+        pthread_mutex_lock( &p->Mutex );
+        p->nDone++;
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+/*
+ * Adds the cone of a partition, whose CIs are all the CIs of pNtk in
+ * order, to pNtkNew and connects the POs it drives.
+ */
+static void abc2java_NtkMfsMerge( Abc_Ntk_t * pNtkNew, Abc_Ntk_t * pNtk, Abc_Ntk_t * pPart, const jint * pPos )
+{
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj;
+    int i;
+
+    Abc_AigConst1(pPart)->pCopy = Abc_AigConst1(pNtkNew);
+    Abc_NtkForEachCi( pPart, pObj, i )
+        pObj->pCopy = Abc_NtkCi(pNtk, i)->pCopy;
+    vNodes = Abc_AigDfs( pPart, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        pObj->pCopy = Abc_AigAnd( (Abc_Aig_t *)pNtkNew->pManFunc, Abc_ObjChild0Copy(pObj), Abc_ObjChild1Copy(pObj) );
+    Vec_PtrFree( vNodes );
+    Abc_NtkForEachPo( pPart, pObj, i )
+        Abc_ObjAddFanin( Abc_NtkPo(pNtk, pPos[i])->pCopy, Abc_ObjChild0Copy(pObj) );
+}
+
+/*
+ * vStats gets { nodes before, nodes after, partitions, partitions
+ * optimized within the budget, threads }, then { cpu, NUMA node,
+ * status } of each thread (see THREAD PLACEMENT).
+ */
+static Abc_Ntk_t * abc2java_NtkMfs( Abc_Ntk_t * pNtk, int nWinTfoLevs, int nFanoutsMax, int nConfLimit,
+                                    int nThreads, int nTimeOutMs, Vec_Int_t * vStats )
+{
+    abc2java_Mfs_t * p;
+    abc2java_Affinity_t Caller;
+    Abc_Ntk_t * pNtkNew;
+    pthread_t * pThreads;
+    jint * pPart, * pPos;
+    int i, k, nPos = Abc_NtkPoNum(pNtk), nPosPart, nStarted;
+
+    p = ABC_CALLOC( abc2java_Mfs_t, 1 );
+    Abc_NtkMfsParsDefault( &p->Pars );
+    p->Pars.nWinTfoLevs = nWinTfoLevs;
+    p->Pars.nFanoutsMax = nFanoutsMax;
+    if ( nConfLimit > 0 || nTimeOutMs <= 0 )
+        p->Pars.nBTLimit = nConfLimit;
+    p->Pars.fArea       = 1;
+    p->Pars.fVerbose    = 0;
+    pthread_mutex_init( &p->Mutex, NULL );
+    if ( nTimeOutMs > 0 )
+    {
+        clock_gettime( CLOCK_MONOTONIC, &p->Deadline );
+        p->Deadline.tv_sec  += nTimeOutMs / 1000;
+        p->Deadline.tv_nsec += (long)(nTimeOutMs % 1000) * 1000000;
+        if ( p->Deadline.tv_nsec >= 1000000000 )
+        {
+            p->Deadline.tv_sec++;
+            p->Deadline.tv_nsec -= 1000000000;
+        }
+        p->fDeadline = 1;
+    }
+
+    // more threads than cpus only add contention (and would overflow below)
+    nThreads = Abc_MinInt( nThreads, Abc_MaxInt(1, (int)sysconf(_SC_NPROCESSORS_ONLN)) );
+    // the cones are created before the threads start, since they write pCopy
+    p->nParts = Abc_NtkLatchNum(pNtk) > 0 || nPos < 2 ? 1 : Abc_MinInt( nPos, 4 * nThreads );
+    p->pParts = ABC_CALLOC( Abc_Ntk_t *, p->nParts );
+    pPart = ABC_ALLOC( jint, nPos + 1 );
+    pPos  = ABC_ALLOC( jint, nPos + 1 );
+    if ( p->nParts == 1 )
+        p->pParts[0] = Abc_NtkDup( pNtk );
+    else
+    {
+        abc2java_NtkPartitionOutputs( pNtk, p->nParts, pPart );
+        for ( k = 0; k < p->nParts; k++ )
+        {
+            for ( nPosPart = i = 0; i < nPos; i++ )
+                if ( pPart[i] == k )
+                    pPos[nPosPart++] = i;
+            p->pParts[k] = abc2java_NtkCreateConeOutputs( pNtk, pPos, nPosPart, 1 );
+        }
+    }
+
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, p->nParts) );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    p->pCpus = abc2java_CpusRead( &p->nCpus );
+    p->pPlacement = ABC_FALLOC( int, ABC2JAVA_PLACE_INTS * nThreads );
+    abc2java_ThreadAffinitySave( &Caller );
+    for ( nStarted = 1; nStarted < nThreads; nStarted++ )
+        if ( pthread_create( &pThreads[nStarted], NULL, abc2java_NtkMfsWorker, p ) != 0 )
+            break;
+    abc2java_NtkMfsWorker( p );
+    for ( i = 1; i < nStarted; i++ )
+        pthread_join( pThreads[i], NULL );
+    if ( p->nCpus > 0 )
+        abc2java_ThreadAffinityRestore( &Caller );
+    ABC_FREE( pThreads );
+
+    if ( p->nParts == 1 )
+        pNtkNew = p->pParts[0];
+    else
+    {
+        pNtkNew = Abc_NtkStartFrom( pNtk, ABC_NTK_STRASH, ABC_FUNC_AIG );
+        for ( k = 0; k < p->nParts; k++ )
+        {
+            for ( nPosPart = i = 0; i < nPos; i++ )
+                if ( pPart[i] == k )
+                    pPos[nPosPart++] = i;
+            abc2java_NtkMfsMerge( pNtkNew, pNtk, p->pParts[k], pPos );
+            Abc_NtkDelete( p->pParts[k] );
+        }
+        Abc_AigCleanup( (Abc_Aig_t *)pNtkNew->pManFunc );
+    }
+    // partitions lose the sharing between them, so the merge can be larger
+    if ( Abc_NtkNodeNum(pNtkNew) >= Abc_NtkNodeNum(pNtk) )
+    {
+        Abc_NtkDelete( pNtkNew );
+        pNtkNew = Abc_NtkDup( pNtk );
+    }
+    Vec_IntPush( vStats, Abc_NtkNodeNum(pNtk) );
+    Vec_IntPush( vStats, Abc_NtkNodeNum(pNtkNew) );
+    Vec_IntPush( vStats, p->nParts );
+    Vec_IntPush( vStats, p->nDone );
+    Vec_IntPush( vStats, p->nThreads );
+    for ( i = 0; i < ABC2JAVA_PLACE_INTS * p->nThreads; i++ )
+        Vec_IntPush( vStats, p->pPlacement[i] );
+    ABC_FREE( pPart );
+    ABC_FREE( pPos );
+    ABC_FREE( p->pParts );
+    ABC_FREE( p->pCpus );
+    ABC_FREE( p->pPlacement );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+    return pNtkNew;
+}
+
+JNIEXPORT jlong JNICALL Java_com_berkeley_abc_Abc_Abc_1NtkMfs
+  (JNIEnv *env, jclass, jlong pAig, jint nWinTfoLevs, jint nFanoutsMax, jint nConfLimit, jint nThreads, jint nTimeOutMs, jintArray stats) {
+    ABC2JAVA_TRACE_TIMED();
+    Abc_Ntk_t *pNtk = reinterpret_cast<Abc_Ntk_t *>(pAig);
+    Vec_Int_t *vStats;
+    jlong result = 0;
+
+    if (!Abc_NtkIsStrash(pNtk) || nWinTfoLevs < 1 || nFanoutsMax < 1 || nThreads < 1 ||
+        (stats != NULL && env->GetArrayLength(stats) < 5)) {
+        standard_exception(env);
+        return 0;
+    }
+    try {
+        vStats = Vec_IntAlloc( 16 );
+        result = reinterpret_cast<jlong>(abc2java_NtkMfs( pNtk, nWinTfoLevs, nFanoutsMax, nConfLimit,
+                                                          nThreads, nTimeOutMs, vStats ));
+        // as much as fits: the placement is only written to longer arrays
+        if (stats != NULL) {
+            env->SetIntArrayRegion(stats, 0, Abc_MinInt(env->GetArrayLength(stats), Vec_IntSize(vStats)), Vec_IntArray(vStats));
+        }
+        Vec_IntFree( vStats );
+    } catch (std::bad_alloc &ba) {
+         out_of_mem_exception(env);
+    }
+    return result;
+}
+#endif /* ABC2JAVA_LEAN */
+
+
+//////////////////////////////////////
+// TRACING
+//////////////////////////////////////
+
+/*
+ * Snapshots of the entry point counters since the last reset. Trace points
+ * are numbered in order of first call; names drop the JNI prefix. In a
+ * build without ABC2JAVA_TRACE there are no trace points.
+ */
+#ifdef ABC2JAVA_TRACE
+static uint64_t abc2java_TraceSumCount( int Id )
+{
+    abc2java_TraceBlock_t * p;
+    uint64_t Sum = 0;
+    for ( p = abc2java_TraceBlocks.load( std::memory_order_acquire ); p; p = p->pNext )
+        Sum += p->Counts[Id].load( std::memory_order_relaxed );
+    return Sum;
+}
+
+static uint64_t abc2java_TraceSumHist( int Slot, int b )
+{
+    abc2java_TraceBlock_t * p;
+    uint64_t Sum = 0;
+    for ( p = abc2java_TraceBlocks.load( std::memory_order_acquire ); p; p = p->pNext )
+        Sum += p->Hist[Slot][b].load( std::memory_order_relaxed );
+    return Sum;
+}
+#endif
+
+JNIEXPORT jboolean JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceEnabled
+  (JNIEnv *env, jclass) {
+#ifdef ABC2JAVA_TRACE
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceNames
+  (JNIEnv *env, jclass) {
+    jobjectArray result = NULL;
+    int nPoints = 0;
+#ifdef ABC2JAVA_TRACE
+    const char *pPrefix = "Java_com_berkeley_abc_Abc_";
+    const char *pName;
+    char Buffer[256];
+    int i, k;
+    jstring s;
+
+    nPoints = abc2java_TraceNum.load( std::memory_order_acquire );
+#endif
+    result = env->NewObjectArray(nPoints, env->FindClass("java/lang/String"), NULL);
+    if (result == NULL) {
+        out_of_mem_exception(env);
+        return NULL;
+    }
+#ifdef ABC2JAVA_TRACE
+    for ( i = 0; i < nPoints; i++ )
+    {
+        pName = abc2java_TraceNames[i];
+        if ( strncmp( pName, pPrefix, strlen(pPrefix) ) == 0 )
+            pName += strlen(pPrefix);
+        // undo the JNI escape of '_'
+        for ( k = 0; *pName && k < (int)sizeof(Buffer) - 1; pName++ )
+        {
+            Buffer[k++] = *pName;
+            if ( pName[0] == '_' && pName[1] == '1' )
+                pName++;
+        }
+        Buffer[k] = 0;
+        s = convertToString(env, Buffer);
+        if (s == NULL) {
+            return NULL;
+        }
+        env->SetObjectArrayElement(result, i, s);
+        env->DeleteLocalRef(s);
+    }
+#endif
+    return result;
+}
+
+/*
+ * Calls per trace point, indexed like Abc_TraceNames.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceCounts
+  (JNIEnv *env, jclass) {
+    jlongArray result = NULL;
+    int nPoints = 0;
+#ifdef ABC2JAVA_TRACE
+    jlong Counts[ABC2JAVA_TRACE_POINTS];
+    int i;
+
+    pthread_mutex_lock( &abc2java_TraceMutex );
+    nPoints = abc2java_TraceNum.load( std::memory_order_acquire );
+    for ( i = 0; i < nPoints; i++ )
+        Counts[i] = (jlong)(abc2java_TraceSumCount(i) - abc2java_TraceBaseCounts[i]);
+    pthread_mutex_unlock( &abc2java_TraceMutex );
+#endif
+    result = env->NewLongArray(nPoints);
+    if (result == NULL) {
+        out_of_mem_exception(env);
+        return NULL;
+    }
+#ifdef ABC2JAVA_TRACE
+    env->SetLongArrayRegion(result, 0, nPoints, Counts);
+#endif
+    return result;
+}
+
+/*
+ * Latency histogram of a timed trace point; empty for untimed points.
+ * See Abc.Abc_TraceBucketLowNs for the bucket bounds.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceHistogram
+  (JNIEnv *env, jclass, jint id) {
+    jlongArray result = NULL;
+    int nBuckets = 0;
+#ifdef ABC2JAVA_TRACE
+    jlong Hist[ABC2JAVA_TRACE_BUCKETS];
+    int b, Slot = -1;
+
+    pthread_mutex_lock( &abc2java_TraceMutex );
+    if ( id >= 0 && id < abc2java_TraceNum.load( std::memory_order_acquire ) )
+        Slot = abc2java_TraceSlots[id];
+    if ( Slot >= 0 )
+    {
+        nBuckets = ABC2JAVA_TRACE_BUCKETS;
+        for ( b = 0; b < nBuckets; b++ )
+            Hist[b] = (jlong)(abc2java_TraceSumHist(Slot, b) - abc2java_TraceBaseHist[Slot][b]);
+    }
+    pthread_mutex_unlock( &abc2java_TraceMutex );
+#endif
+    result = env->NewLongArray(nBuckets);
+    if (result == NULL) {
+        out_of_mem_exception(env);
+        return NULL;
+    }
+#ifdef ABC2JAVA_TRACE
+    env->SetLongArrayRegion(result, 0, nBuckets, Hist);
+#endif
+    return result;
+}
+
+/*
+ * Trace sites that found the points or the histogram slots used up; 0
+ * unless the caps above are too small for the tree.
+ */
+JNIEXPORT jint JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceDropped
+  (JNIEnv *env, jclass) {
+    jint result = 0;
+#ifdef ABC2JAVA_TRACE
+    pthread_mutex_lock( &abc2java_TraceMutex );
+    result = abc2java_TraceDropped;
+    pthread_mutex_unlock( &abc2java_TraceMutex );
+#endif
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_berkeley_abc_Abc_Abc_1TraceReset
+  (JNIEnv *env, jclass) {
+#ifdef ABC2JAVA_TRACE
+    int i, b;
+
+    pthread_mutex_lock( &abc2java_TraceMutex );
+    for ( i = 0; i < abc2java_TraceNum.load( std::memory_order_acquire ); i++ )
+        abc2java_TraceBaseCounts[i] = abc2java_TraceSumCount(i);
+    for ( i = 0; i < abc2java_TraceTimedNum; i++ )
+        for ( b = 0; b < ABC2JAVA_TRACE_BUCKETS; b++ )
+            abc2java_TraceBaseHist[i][b] = abc2java_TraceSumHist(i, b);
+    pthread_mutex_unlock( &abc2java_TraceMutex );
+#endif
+}
+
+
+//////////////////////////////////////
+// FOREIGN ACCESSORS
+//////////////////////////////////////
+
+/*
+ * Plain C entry points for the small read-only accessors, bound by
+ * AbcForeign through java.lang.foreign downcalls. They take no JNIEnv
+ * and cannot allocate, so they are safe to call as critical downcalls.
+ */
+#ifndef ABC2JAVA_LEAN
+JNIEXPORT int64_t abc2java_Abc_ObjId( void * pObj )             { return Abc_ObjId( (Abc_Obj_t *)pObj ); }
+JNIEXPORT int abc2java_Abc_ObjIsCi( void * pObj )               { return Abc_ObjIsCi( (Abc_Obj_t *)pObj ); }
+JNIEXPORT int abc2java_Abc_AigNodeIsConst( void * pObj )        { return Abc_AigNodeIsConst( (Abc_Obj_t *)pObj ); }
+JNIEXPORT void * abc2java_Abc_ObjFanin0( void * pObj )          { return Abc_ObjFanin0( (Abc_Obj_t *)pObj ); }
+JNIEXPORT void * abc2java_Abc_ObjFanin1( void * pObj )          { return Abc_ObjFanin1( (Abc_Obj_t *)pObj ); }
+JNIEXPORT int abc2java_Abc_ObjFaninC0( void * pObj )            { return Abc_ObjFaninC0( (Abc_Obj_t *)pObj ); }
+JNIEXPORT int abc2java_Abc_ObjFaninC1( void * pObj )            { return Abc_ObjFaninC1( (Abc_Obj_t *)pObj ); }
+JNIEXPORT void * abc2java_Abc_ObjChild0( void * pObj )          { return Abc_ObjChild0( (Abc_Obj_t *)pObj ); }
+JNIEXPORT void * abc2java_Abc_ObjChild1( void * pObj )          { return Abc_ObjChild1( (Abc_Obj_t *)pObj ); }
+#endif
+
+JNIEXPORT int abc2java_Fraig_NodeReadNum( void * fObj )         { return Fraig_NodeReadNum( (Fraig_Node_t *)fObj ); }
+JNIEXPORT int abc2java_Fraig_NodeIsVar( void * fObj )           { return Fraig_NodeIsVar( (Fraig_Node_t *)fObj ); }
+JNIEXPORT int abc2java_Fraig_NodeIsConst( void * fObj )         { return Fraig_NodeIsConst( (Fraig_Node_t *)fObj ); }
+JNIEXPORT void * abc2java_Fraig_NodeReadOne( void * fObj )      { return Fraig_NodeReadOne( (Fraig_Node_t *)fObj ); }
+JNIEXPORT void * abc2java_Fraig_NodeReadTwo( void * fObj )      { return Fraig_NodeReadTwo( (Fraig_Node_t *)fObj ); }
+
+JNIEXPORT int abc2java_Ivy_ObjId( void * fObj )                 { return Ivy_ObjId( (Ivy_Obj_t *)fObj ); }
+JNIEXPORT int abc2java_Ivy_ObjIsPi( void * fObj )               { return Ivy_ObjIsPi( (Ivy_Obj_t *)fObj ); }
+JNIEXPORT int abc2java_Ivy_ObjIsConst1( void * fObj )           { return Ivy_ObjIsConst1( (Ivy_Obj_t *)fObj ); }
+JNIEXPORT void * abc2java_Ivy_ObjChild0( void * fObj )          { return Ivy_ObjChild0( (Ivy_Obj_t *)fObj ); }
+JNIEXPORT void * abc2java_Ivy_ObjChild1( void * fObj )          { return Ivy_ObjChild1( (Ivy_Obj_t *)fObj ); }
+JNIEXPORT void * abc2java_Ivy_ObjEquiv( void * fObj )           { return Ivy_ObjEquiv( (Ivy_Obj_t *)fObj ); }
+
 
 #ifdef __cplusplus
 }